@@ -0,0 +1,80 @@
+#ifndef ASSETBUNDLE_T_H
+#define ASSETBUNDLE_T_H
+
+#include <string>
+#include <memory>
+#include <mutex>
+#include <ctime>
+#include <filesystem>
+#include "misc.h"
+
+// Bundle file layout, all integers little endian:
+//
+//   header : char magic[8] = "WWBNDL01", u32 version, u32 count, u64 index_offset, u64 index_size
+//   data   : the contents of the entries, 8 byte aligned
+//   index  : count times
+//              u32 path_len, u32 content_type_len, u32 etag_len, u32 flags,
+//              u64 offset, u64 size, u64 gz_offset, u64 gz_size,
+//              path, content_type, etag
+//
+// Paths are relative to the mount prefix and use '/'. gz_offset and gz_size are reserved for gzip
+// variants and written as 0: the files handler gets no Accept-Encoding to choose them by.
+// The packer is tools/webui-wire-pack.cpp.
+
+#define ASSET_BUNDLE_MAGIC          "WWBNDL01"
+#define ASSET_BUNDLE_MAGIC_SIZE     8
+#define ASSET_BUNDLE_VERSION        1
+#define ASSET_BUNDLE_HEADER_SIZE    32
+#define ASSET_BUNDLE_INDEX_FIXED    48
+#define ASSET_BUNDLE_FLAG_HTML      0x1
+
+class AssetBundleEntry_t
+{
+public:
+    std::string path;
+    std::string content_type;
+    std::string etag;
+    bool        is_html;
+    size_t      offset;
+    size_t      size;
+};
+
+class AssetBundle_t;
+
+typedef std::shared_ptr<AssetBundle_t> AssetBundlePtr;
+
+////////////////////////////////////////////////////////////////////////////////////
+/// \brief AssetBundle_t - a packed, indexed archive of files. The index is kept in
+/// memory, entries are read from the bundle file straight into the response.
+/// Bundles are mounted at an url path prefix.
+////////////////////////////////////////////////////////////////////////////////////
+class AssetBundle_t
+{
+private:
+    std::string                             _file;
+    size_t                                  _size;
+    std::filesystem::file_time_type         _file_mtime;
+    std::time_t                             _mtime;
+    wwhash<std::string, AssetBundleEntry_t> _entries;
+
+private:
+    static std::mutex                           _mounts_mutex;
+    static wwhash<std::string, AssetBundlePtr>  _mounts;
+
+public:
+    bool open(const std::string &file, std::string &error);
+    const AssetBundleEntry_t *entry(const std::string &path);
+    bool unchanged();
+    bool read(size_t offset, size_t size, std::string &dest);
+    std::string file();
+    std::time_t lastModified();
+    size_t count();
+
+public:
+    static bool mount(const std::string &url_prefix, const std::string &file, std::string &error, size_t &count);
+    static bool unmount(const std::string &url_prefix);
+    static AssetBundlePtr find(const std::string &url_path, std::string &entry_path);    // entry_path "" for the bare prefix
+    static std::string normalizedPrefix(const std::string &url_prefix);
+};
+
+#endif // ASSETBUNDLE_T_H
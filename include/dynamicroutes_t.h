@@ -0,0 +1,90 @@
+#ifndef DYNAMICROUTES_T_H
+#define DYNAMICROUTES_T_H
+
+#include <string>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <chrono>
+#include <ctime>
+#include "misc.h"
+#include "json.h"
+
+#define DYNAMIC_ROUTE_TIMEOUT_MS            5000
+#define DYNAMIC_ROUTE_CACHE_MAX_BYTES       (16 * 1024 * 1024)
+
+class DynamicResponse_t
+{
+public:
+    int                                     code;
+    std::string                             content_type;
+    std::string                             cache_control;
+    std::string                             data;
+    std::string                             etag;
+    std::time_t                             modified;
+    std::chrono::steady_clock::time_point   expires_at;
+};
+
+typedef std::shared_ptr<const DynamicResponse_t> DynamicResponsePtr;
+
+////////////////////////////////////////////////////////////////////////////////////
+/// \brief DynamicRoutes_t - url prefixes that are answered by the host. filesHandler
+/// sends a request event with an id and waits for the 'respond' command with that
+/// id. Answers with a max-age in their Cache-Control are kept and served from
+/// memory until they expire; concurrent requests for the same path share one event.
+////////////////////////////////////////////////////////////////////////////////////
+class DynamicRoutes_t
+{
+private:
+    class Pending_t
+    {
+    public:
+        std::string         path;
+        int                 id;
+        int                 waiters;        // The request is dropped when the last one gives up
+        bool                done;
+        DynamicResponsePtr  response;
+    };
+    typedef std::shared_ptr<Pending_t> PendingPtr;
+
+private:
+    std::mutex                              _mutex;
+    std::condition_variable                 _answered;
+    wwhash<std::string, int>                _routes;        // prefix -> timeout in ms
+    wwhash<int, PendingPtr>                 _pending;       // request id -> waiting request
+    wwhash<std::string, PendingPtr>         _in_flight;     // path -> waiting request
+    wwhash<std::string, DynamicResponsePtr> _cache;         // path -> cached answer
+    size_t                                  _cache_bytes;
+    int                                     _next_id;
+
+private:
+    unsigned long long                      _requests;
+    unsigned long long                      _hits;
+    unsigned long long                      _coalesced;
+    unsigned long long                      _timeouts;
+
+private:
+    void expire();
+    void dropCached(const std::string &prefix);
+    static int maxAge(const std::string &cache_control);
+
+public:
+    void addRoute(const std::string &prefix, int timeout_ms);
+    bool removeRoute(const std::string &prefix);
+    bool route(const std::string &path, std::string &prefix, int &timeout_ms);
+
+public:
+    DynamicResponsePtr request(const std::string &path, int timeout_ms, std::function<void(int id)> send_request);
+    bool respond(int id, int code, const std::string &content_type, const std::string &cache_control, const std::string &data);
+    JSON stats();
+
+public:
+    static std::string normalizedPrefix(const std::string &prefix);
+    static DynamicRoutes_t &shared();
+
+public:
+    DynamicRoutes_t();
+};
+
+#endif // DYNAMICROUTES_T_H
@@ -2,6 +2,8 @@
 #define EXECJS_H
 
 #include <string>
+#include <functional>
+#include "json.h"
 
 class WebUIWindow;
 class WebWireHandler;
@@ -28,6 +30,13 @@ public:
     void run(const std::string &code);
     std::string call(const std::string &code, bool &ok);
 
+    // Calls a function registered on the page with web_wire_register(), see WebWireProfile
+    void invoke(const std::string &fn, const JSON &args);
+    std::string invoke(const std::string &fn, const JSON &args, bool &ok);
+
+private:
+    std::string waitForResult(const std::string &code, std::function<bool()> send, bool &ok);
+
 public:
     void setResult(std::string result, bool result_ok, std::string msg);
 
@@ -0,0 +1,80 @@
+#ifndef FILECACHE_T_H
+#define FILECACHE_T_H
+
+#include <string>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <filesystem>
+#include "misc.h"
+#include "json.h"
+
+#define FILE_CACHE_DEFAULT_MAX_BYTES        (64 * 1024 * 1024)
+#define FILE_CACHE_DEFAULT_MAX_ENTRY_BYTES  (4 * 1024 * 1024)
+
+class FileCacheEntry_t
+{
+public:
+    std::string                     file;
+    std::filesystem::file_time_type mtime;
+    size_t                          size;
+    bool                            is_html;
+    std::string                     content_type;
+    std::string                     etag;
+    std::time_t                     last_modified;
+    std::string                     data;       // Complete http response, or the raw file for html
+                                                // (html gets per window scripts injected)
+};
+
+typedef std::shared_ptr<const FileCacheEntry_t> FileCacheEntryPtr;
+
+////////////////////////////////////////////////////////////////////////////////////
+/// \brief FileCache_t - size bounded LRU cache of file responses, shared by all
+/// windows. An entry is only valid as long as the mtime and size of the file match.
+////////////////////////////////////////////////////////////////////////////////////
+class FileCache_t
+{
+private:
+    typedef std::list<std::string>                      LruList;
+    typedef struct {
+        FileCacheEntryPtr entry;
+        LruList::iterator lru_it;
+    } Slot_t;
+
+private:
+    std::mutex                  _mutex;
+    wwhash<std::string, Slot_t> _entries;
+    LruList                     _lru;           // front = most recently used
+    size_t                      _bytes;
+    size_t                      _max_bytes;
+    size_t                      _max_entry_bytes;
+
+private:
+    unsigned long long          _hits;
+    unsigned long long          _misses;
+    unsigned long long          _evictions;
+    unsigned long long          _bytes_served;
+
+private:
+    void evict(const std::string &file);
+    void shrinkTo(size_t max_bytes);
+
+public:
+    FileCacheEntryPtr lookup(const std::string &file, std::filesystem::file_time_type mtime, size_t size);
+    void insert(FileCacheEntryPtr entry);
+    bool cacheable(size_t size);
+    void clear();
+
+public:
+    void setMaxBytes(size_t max_bytes);
+    void setMaxEntryBytes(size_t max_entry_bytes);
+    JSON stats();
+
+public:
+    static FileCache_t &shared();
+
+public:
+    FileCache_t();
+};
+
+#endif // FILECACHE_T_H
@@ -0,0 +1,71 @@
+#ifndef HTMLDIFF_T_H
+#define HTMLDIFF_T_H
+
+#include <string>
+#include <memory>
+#include <vector>
+#include "misc.h"
+#include "json.h"
+
+#define HTML_DIFF_MAX_LCS_CELLS     (4 * 1024 * 1024)   // Larger child lists are matched by position
+
+class HtmlNode_t;
+typedef std::shared_ptr<HtmlNode_t> HtmlNodePtr;
+
+class HtmlNode_t
+{
+public:
+    typedef enum {
+        element = 1,
+        text,
+        comment
+    } Kind;
+
+public:
+    Kind                                                kind;
+    std::string                                         tag;        // Lower case, empty for the root
+    std::vector<std::pair<std::string, std::string>>    attrs;      // Values as in the source, entities included
+    std::string                                         data;       // Text or comment, as in the source
+    std::vector<HtmlNodePtr>                            children;
+    bool                                                foreign;    // Inside svg or math
+
+public:
+    std::string attr(const std::string &name) const;
+    std::string identity() const;
+    std::string signature() const;      // The nodeName the page compares against
+    std::string outerHtml() const;
+    std::string innerHtml() const;
+
+public:
+    HtmlNode_t(Kind k);
+};
+
+////////////////////////////////////////////////////////////////////////////////////
+/// \brief HtmlDiff_t - parses html fragments the way a browser builds the children of
+/// an element (implied end tags, implied tbody, void and raw text elements) and
+/// computes a patch from one fragment to the next. Children are matched on tag and
+/// id or data-key, so keyed lists only patch what changed.
+///
+/// A patch is a list of operations on paths of child indices in the old tree:
+///   ["count", path, n]                    the node at path has n children
+///   ["text", path, sig, data]             sets the text of a text or comment node
+///   ["attrs", path, sig, {set}, [del]]    sets and removes attributes
+///   ["replace", path, sig, html]          replaces the node
+///   ["remove", path, sig]                 removes the node
+///   ["insert", path, index, html]         inserts html at child index of the (new) children
+/// Removes follow all updates, inserts come last and ascend per parent.
+////////////////////////////////////////////////////////////////////////////////////
+class HtmlDiff_t
+{
+private:
+    static void diffNode(const HtmlNodePtr &from, const HtmlNodePtr &to, const JSON &path,
+                         JSON &updates, JSON &removes, JSON &inserts);
+    static void diffChildren(const HtmlNodePtr &from, const HtmlNodePtr &to, const JSON &path,
+                             JSON &updates, JSON &removes, JSON &inserts);
+
+public:
+    static HtmlNodePtr parse(const std::string &html);
+    static JSON diff(const HtmlNodePtr &from, const HtmlNodePtr &to);
+};
+
+#endif // HTMLDIFF_T_H
@@ -2,8 +2,15 @@
 #define HTTPRESPONSE_T_H
 
 #include <string>
+#include <ctime>
+#include <climits>
+#include <mutex>
+#include <filesystem>
 #include "misc.h"
 
+// webui takes the length of a response as an int, larger bodies are refused
+#define HTTP_MAX_BODY_SIZE      (INT_MAX - 64 * 1024)
+
 class WebWireHandler;
 
 class HttpResponse_t
@@ -17,6 +24,13 @@ private:
     int                              _content_size;
     std::string                      _content;
     std::string                      _file;
+    bool                             _file_part;
+    size_t                           _file_offset;
+    size_t                           _file_size;
+
+private:
+    static std::mutex                       _policy_mutex;
+    static wwhash<std::string, std::string> _cache_control;
 
 private:
     int                              _http_response_size;
@@ -27,14 +41,27 @@ public:
     void setContentType(std::string content_type);
     void addHeader(std::string name, std::string content);
     void setContent(const std::string &content);
+    void setCachePolicy(const std::string &policy);
     void setFile(const std::string &file);
+    void setFilePart(const std::string &file, size_t offset, size_t size);
+    void setValidators(const std::string &etag, std::time_t last_modified);
 
 public:
     std::string contentTypeForFileExt(std::string ext);
     static std::string codeText(int code);
+    static std::string httpDate(std::time_t t);
+    static std::string etag(std::filesystem::file_time_type mtime, size_t size);
+    static std::string etag(const std::string &content);
+
+public:
+    static void setCacheControl(const std::string &path_prefix, const std::string &policy);
+    static std::string cacheControl(const std::string &path);
 
 public:
+    std::string header(size_t content_size);
     const char *response(int &content_length);
+    const char *injectedResponse(const char *body, size_t body_size, size_t at, const std::string &insert, int &length);
+    static const char *response(const std::string &http_response, int &length);
 
 public:
     HttpResponse_t(WebWireHandler *h, int code = 200);
@@ -1,8 +1,13 @@
 #ifndef APPLE_UTILS_H
 #define APPLE_UTILS_H
 
+#include <stddef.h>
+
 void process_events_apple();
 void init_app_apple();
 void focus_window_apple(void *);
+void show_window_apple(void *, bool show);
+void set_window_title_apple(void *, const char *title);
+void watch_window_geometry_apple(void *window, void (*cb)(size_t id, int x, int y, int w, int h), size_t id);
 
 #endif // APPLE_UTILS_H
@@ -2,6 +2,7 @@
 #define FILEINFO_T_H
 
 #include <string>
+#include <ctime>
 #include <filesystem>
 
 class FileInfo_t
@@ -12,12 +13,17 @@ public:
     bool exists();
     bool isReadable();
     size_t size();
+    std::filesystem::file_time_type lastModified();
+    size_t read(size_t offset, size_t n, char *dest);
 
 public:
     bool mkPath();
     unsigned int removeRecursively();
     std::string ext();
 
+public:
+    static std::time_t toTime(std::filesystem::file_time_type t);
+
 public:
     std::string toString();
     std::filesystem::path toPath();
@@ -80,16 +80,16 @@ public:
 
     // Template T constructors
     template <typename T>
-    JSON( T b, typename std::enable_if<std::is_same<T,bool>::value>::type* = 0 );
+    JSON( T b, typename std::enable_if<std::is_same<T,bool>::value>::type* = 0 ) : Internal( b ), Type( Class::Boolean ){}
 
     template <typename T>
-    JSON( T i, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T,bool>::value>::type* = 0 );
+    JSON( T i, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T,bool>::value>::type* = 0 ) : Internal( (long)i ), Type( Class::Integral ){}
 
     template <typename T>
-    JSON( T f, typename std::enable_if<std::is_floating_point<T>::value>::type* = 0 );
+    JSON( T f, typename std::enable_if<std::is_floating_point<T>::value>::type* = 0 ) : Internal( (double)f ), Type( Class::Floating ){}
 
     template <typename T>
-    JSON( T s, typename std::enable_if<std::is_convertible<T, std::string>::value>::type* = 0 );
+    JSON( T s, typename std::enable_if<std::is_convertible<T, std::string>::value>::type* = 0 ) : Internal( std::string( s ) ), Type( Class::String ){}
 
     ~JSON() {
         switch( Type ) {
@@ -167,6 +167,10 @@ public:
     std::string toString() const;
     std::string toString( bool &ok ) const;
 
+    /// The string as it was loaded, toString() returns it json escaped.
+    std::string toRawString() const;
+    std::string toRawString( bool &ok ) const;
+
     double toFloat() const;
     double toFloat( bool &ok ) const;
 
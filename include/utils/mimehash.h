@@ -0,0 +1,48 @@
+#ifndef MIMEHASH_H
+#define MIMEHASH_H
+
+#include <string_view>
+
+// Shared by the generated mimetype table (tools/webui-wire-mimegen.cpp) and the lookup
+// in MimeTypes_t. Extensions are hashed without their leading '.', case insensitive.
+
+typedef struct {
+    const char *ext;            // lower case, without '.', nullptr for an empty slot
+    const char *mimetype;
+} MimeTableEntry_t;
+
+constexpr char mime_lower(char c)
+{
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+constexpr std::string_view mime_ext(std::string_view ext)
+{
+    return (!ext.empty() && ext[0] == '.') ? ext.substr(1) : ext;
+}
+
+constexpr unsigned int mime_hash(std::string_view ext, unsigned int seed)
+{
+    unsigned int h = 2166136261u ^ (seed * 0x9e3779b9u);
+    for(char c : ext) {
+        h ^= static_cast<unsigned char>(mime_lower(c));
+        h *= 16777619u;
+    }
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    return h;
+}
+
+constexpr bool mime_ext_equal(std::string_view ext, const char *lower_ext)
+{
+    size_t i = 0;
+    for(; i < ext.size(); i++) {
+        if (lower_ext[i] == '\0' || mime_lower(ext[i]) != lower_ext[i]) {
+            return false;
+        }
+    }
+    return lower_ext[i] == '\0';
+}
+
+#endif // MIMEHASH_H
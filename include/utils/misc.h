@@ -6,6 +6,8 @@
 #include <thread>
 #include <unordered_map>
 #include <algorithm>
+#include <cstring>
+#include <cctype>
 
 #include "utf8_utils.h"
 #include "webui_wire_defs.h"
@@ -150,6 +152,48 @@ inline std::string replace(std::string str, std::string find_str, std::string re
     return str;
 }
 
+// Case insensitive search of an ascii needle, returns std::string::npos if not found.
+// Candidates are located with memchr (vectorized by the C library) for both cases of
+// the first character, so long haystacks are not compared byte by byte.
+inline size_t find_nocase(const char *hay, size_t n, const char *needle, size_t needle_len)
+{
+    if (needle_len == 0 || needle_len > n) {
+        return (needle_len == 0) ? 0 : std::string::npos;
+    }
+
+    int lc = std::tolower(static_cast<unsigned char>(needle[0]));
+    int uc = std::toupper(static_cast<unsigned char>(needle[0]));
+    size_t last = n - needle_len;
+    size_t from = 0;
+    const char *end = hay + last + 1;
+    const char *pl = static_cast<const char *>(memchr(hay, lc, last + 1));
+    const char *pu = (uc == lc) ? nullptr : static_cast<const char *>(memchr(hay, uc, last + 1));
+    while (from <= last) {
+        // Only rescan for the case whose last candidate has been passed
+        if (pl != nullptr && pl < hay + from) {
+            pl = static_cast<const char *>(memchr(hay + from, lc, end - (hay + from)));
+        }
+        if (pu != nullptr && pu < hay + from) {
+            pu = static_cast<const char *>(memchr(hay + from, uc, end - (hay + from)));
+        }
+        const char *p = (pl == nullptr) ? pu : ((pu == nullptr || pl < pu) ? pl : pu);
+        if (p == nullptr) {
+            return std::string::npos;
+        }
+        size_t i = 1;
+        while (i < needle_len && std::tolower(static_cast<unsigned char>(p[i])) ==
+                                 std::tolower(static_cast<unsigned char>(needle[i]))) {
+            i++;
+        }
+        if (i == needle_len) {
+            return p - hay;
+        }
+        from = (p - hay) + 1;
+    }
+
+    return std::string::npos;
+}
+
 inline int toInt(const std::string &s, bool *ok = nullptr)
 {
     bool _ok = true;
@@ -209,7 +253,23 @@ inline double toDouble(const std::string &s, bool *ok = nullptr)
 }
 
 
+// 64 bit FNV-1a hash, good enough to version content (not for security)
+inline unsigned long long fnv1a64(const char *data, size_t len, unsigned long long h = 0xcbf29ce484222325ULL)
+{
+    for(size_t i = 0; i < len; i++) {
+        h ^= static_cast<unsigned char>(data[i]);
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+inline unsigned long long fnv1a64(const std::string &s)
+{
+    return fnv1a64(s.data(), s.size());
+}
+
 std::string asprintf(const char *fmt_str, ...);
+bool base64_decode(const std::string &in, std::string &out);
 
 WEBUI_WIRE_EXPORT void setThreadName(std::thread *thr, std::string name);
 WEBUI_WIRE_EXPORT void terminateThread(std::thread *thr);
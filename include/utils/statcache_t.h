@@ -0,0 +1,90 @@
+#ifndef STATCACHE_T_H
+#define STATCACHE_T_H
+
+#include <string>
+#include <list>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <filesystem>
+#include "misc.h"
+#include "json.h"
+
+#define STAT_CACHE_MAX_ENTRIES      4096
+#define STAT_CACHE_MAX_PATH         1024        // Longer 'paths' (e.g. html given to set-inner-html) are not kept
+#define STAT_CACHE_TTL_MS           1000        // Entries that are not watched (no inotify) expire after this
+#define STAT_CACHE_MISS_SYSCALLS    3           // status, file_size and last_write_time for a miss
+
+class FileStat_t
+{
+public:
+    bool                            exists;
+    bool                            readable;
+    bool                            is_dir;
+    size_t                          size;
+    std::filesystem::file_time_type mtime;
+};
+
+////////////////////////////////////////////////////////////////////////////////////
+/// \brief StatCache_t - caches the metadata of paths that are looked up for every
+/// request and command. On Linux the parent directories are watched with inotify
+/// and entries are dropped when something changes; elsewhere entries expire.
+/// At most STAT_CACHE_MAX_ENTRIES are kept, the least recently used go first.
+////////////////////////////////////////////////////////////////////////////////////
+class StatCache_t
+{
+private:
+    typedef std::list<std::string>                  LruList;
+    typedef struct {
+        FileStat_t                              st;
+        bool                                    watched;
+        std::chrono::steady_clock::time_point   at;
+        LruList::iterator                       lru_it;
+        int                                     wd;         // -1 if not registered with a watch
+        std::string                             name;       // file name in the watched directory
+    } Entry_t;
+
+private:
+    std::mutex                                      _mutex;
+    wwhash<std::string, Entry_t>                    _entries;
+    LruList                                         _lru;               // front = most recently used
+
+private:
+    int                                             _inotify_fd;
+    wwhash<std::string, int>                        _dir_watches;
+    wwhash<int, wwhash<std::string, std::stringlist>> _watched_names;    // wd -> file name -> cache keys
+    wwhash<int, unsigned long long>                 _generations;       // bumped on every change in a dir
+    wwhash<int, int>                                _dir_refs;          // wd -> entries (and lookups) using it
+    std::thread                                    *_watcher;
+    std::atomic<bool>                               _stop;
+
+private:
+    unsigned long long                              _hits;
+    unsigned long long                              _misses;
+    unsigned long long                              _invalidations;
+
+private:
+    static void statPath(const std::string &path, FileStat_t &st);
+    int watch(const std::string &path, std::string &name);
+    size_t drop(const std::string &path);
+    void release(int wd);
+    void watcher();
+    void invalidate(int wd, const std::string &name);
+    void invalidateDir(int wd);
+
+public:
+    void stat(const std::string &path, FileStat_t &st);
+    void clear();
+    static bool plausiblePath(const std::string &text);
+    JSON stats();
+
+public:
+    static StatCache_t &shared();
+
+public:
+    StatCache_t();
+    ~StatCache_t();
+};
+
+#endif // STATCACHE_T_H
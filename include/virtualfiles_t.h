@@ -0,0 +1,55 @@
+#ifndef VIRTUALFILES_T_H
+#define VIRTUALFILES_T_H
+
+#include <string>
+#include <memory>
+#include <mutex>
+#include <chrono>
+#include <ctime>
+#include "misc.h"
+#include "json.h"
+
+class VirtualFile_t
+{
+public:
+    std::string                             path;
+    std::string                             content_type;
+    std::string                             data;
+    std::string                             etag;
+    std::time_t                             modified;
+    bool                                    expires;
+    std::chrono::steady_clock::time_point   expires_at;
+};
+
+typedef std::shared_ptr<const VirtualFile_t> VirtualFilePtr;
+
+////////////////////////////////////////////////////////////////////////////////////
+/// \brief VirtualFiles_t - content put by the host (put-file), served from memory
+/// by filesHandler before anything on disk. Files can expire after a ttl.
+////////////////////////////////////////////////////////////////////////////////////
+class VirtualFiles_t
+{
+private:
+    std::mutex                          _mutex;
+    wwhash<std::string, VirtualFilePtr> _files;
+    size_t                              _bytes;
+    unsigned long long                  _hits;
+
+private:
+    void expire();
+
+public:
+    void put(const std::string &path, const std::string &content_type, const std::string &data, int ttl_seconds);
+    bool remove(const std::string &path);
+    VirtualFilePtr get(const std::string &path);
+    JSON stats();
+
+public:
+    static std::string normalizedPath(const std::string &path);
+    static VirtualFiles_t &shared();
+
+public:
+    VirtualFiles_t();
+};
+
+#endif // VIRTUALFILES_T_H
@@ -0,0 +1,53 @@
+#ifndef VIRTUALLIST_T_H
+#define VIRTUALLIST_T_H
+
+#include <string>
+#include <memory>
+#include <mutex>
+#include <chrono>
+#include "misc.h"
+#include "json.h"
+
+#define VIRTUAL_LIST_PENDING_MS         5000    // A range asked from the host is asked again after this
+#define VIRTUAL_LIST_MAX_WANTED         10000   // Rows the page waits for, beyond this they are forgotten
+
+////////////////////////////////////////////////////////////////////////////////////
+/// \brief VirtualList_t - the rows of a virtual-list that webui-wire keeps for a page
+/// element. Rows the page asks for are answered from here when possible; what is
+/// missing is asked from the host together with 'prefetch' rows on both sides, so
+/// scrolling on usually finds its rows here. At most 'cache_rows' rows are kept,
+/// the ones farthest from the last request are dropped first.
+////////////////////////////////////////////////////////////////////////////////////
+class VirtualList_t
+{
+private:
+    std::mutex                                              _mutex;
+    int                                                     _rows;
+    int                                                     _cache_rows;
+    int                                                     _prefetch;
+    wwhash<int, JSON>                                       _cached;
+    wwhash<int, std::chrono::steady_clock::time_point>      _pending;   // row -> asked from the host at
+    wwhash<int, bool>                                       _wanted;    // rows the page waits for
+    int                                                     _center;
+
+private:
+    void evict();
+    static void addToRuns(JSON &runs, int row, const JSON &data, int &run_from);
+
+public:
+    // Returns the cached rows of [from, from + count) as a list of [from, [rows...]] runs.
+    // host_runs gets the [from, count] runs of missing rows that must be asked from the host.
+    JSON request(int from, int count, JSON &host_runs);
+
+    // Keeps the rows the host answered and returns the ones the page waits for, as runs.
+    JSON put(int from, const JSON &rows);
+
+    void setRowCount(int rows, bool reset);
+
+public:
+    VirtualList_t(int rows, int cache_rows, int prefetch);
+};
+
+typedef std::shared_ptr<VirtualList_t> VirtualListPtr;
+
+#endif // VIRTUALLIST_T_H
@@ -4,8 +4,16 @@
 #include "object_t.h"
 #include "misc.h"
 #include "fileinfo_t.h"
+#include "filecache_t.h"
+#include "assetbundle_t.h"
+#include "virtualfiles_t.h"
+#include "dynamicroutes_t.h"
+#include "htmldiff_t.h"
+#include "virtuallist_t.h"
 #include <string>
 #include <functional>
+#include <mutex>
+#include <chrono>
 extern "C" {
 #include <webui.h>
 }
@@ -18,9 +26,21 @@ extern "C" {
 typedef void NSWindow;
 #endif
 
+#define id_window_geometry  "window-geometry"
+#define evt_window_geometry Event_t(id_window_geometry, this)
+
+#define NATIVE_GEOMETRY_COALESCE_MS 100
+
+#define PAGE_READY_TIMEOUT_MS       10000   // A call waits this long for a page that is still loading
+#define PAGE_READY_MAX_QUEUED       1000    // Scripts kept for a page that is still loading
+#define DISCONNECT_GRACE_MS         1500    // Same as the close check in webuiEvent
+
+#define HTML_DIFF_CACHE_MAX_BYTES   (4 * 1024 * 1024)   // Per window, html kept for set-inner-html with diff
+
 class WebWireHandler;
 class WebWireProfile;
 class ExecJs;
+class HttpResponse_t;
 
 typedef enum {
     hidden = 0x000,
@@ -30,6 +50,33 @@ typedef enum {
     st_normal = 0x004
 } WebUiWindow_ShowState;
 
+////////////////////////////////////////////////////////////////////////////////////
+/// \brief WindowSpec_t - what 'new' can set before a window is shown for the first
+/// time: {"width", "height", "x", "y", "title", "icon", "url" or "html", "css"}
+////////////////////////////////////////////////////////////////////////////////////
+class WindowSpec_t
+{
+public:
+    bool            size_set;
+    int             width;
+    int             height;
+    bool            pos_set;
+    int             x;
+    int             y;
+    std::string     title;
+    std::string     icon;
+    std::string     url;            // Loaded as with set-url
+    std::string     html;           // A file, loaded as with set-html
+    std::string     css;
+
+public:
+    bool load(const std::string &json, std::string &error);
+    bool hasContent() const;
+
+public:
+    WindowSpec_t();
+};
+
 class WebUIWindow : public Object_t
 {
 private:
@@ -51,18 +98,51 @@ private:
     WebUIWindow    *_parent_win;
     bool            _disconnected;
     bool            _page_loaded;
+    std::mutex      _ready_mutex;
+    wwlist<std::string> _queued_js;     // Scripts that wait for page-loaded
+    size_t          _ready_connection;  // The connection that reported page-loaded
+    std::chrono::steady_clock::time_point _disconnected_at;
+    std::mutex      _html_mutex;
+    wwhash<std::string, HtmlNodePtr> _html_trees;      // element id -> tree of the html it was last set to
+    wwhash<std::string, std::string> _html_sources;
+    size_t          _html_bytes;
+    std::mutex      _list_mutex;
+    wwhash<std::string, VirtualListPtr> _virtual_lists;    // element id -> rows kept for its virtual-list
     ExecJs         *_exec_js;
     int             _served;
+    bool            _start_hidden;
+    bool            _detached;          // Pooled or prerendering, the host does not know this window yet
+    int             _companion_of;      // The window this one prerenders for, or -1
+    std::string     _initial_title;
+    std::string     _initial_css;       // Of the spec, for the first page only
+    int             _initial_handle;
 #ifdef _WINDOWS
         HWND        _win_handle;
+        HWND        _geometry_watched_handle;
 #else
     #ifdef __linux
         GtkWindow   *_win_handle;
+        GtkWindow   *_geometry_watched_handle;
+        guint        _geometry_flush_source;
     #else
         NSWindow    *_win_handle;
+        NSWindow    *_geometry_watched_handle;
     #endif
 #endif
 
+private:
+    bool            _geometry_reported;
+    Point_t         _reported_pos;
+    Size_t          _reported_size;
+    Point_t         _pending_pos;
+    Size_t          _pending_size;
+
+private:
+    void watchNativeGeometry();
+    void setNativeTitle(const std::string &title);
+    FileCacheEntryPtr loadFile(FileInfo_t &fi, std::filesystem::file_time_type mtime, size_t file_size,
+                               const std::string &cache_control);
+
 private:
     static const char *_default_favicon;
 
@@ -71,6 +151,8 @@ public:
     std::string baseUrl();
     std::string rootFolder();
     std::string standardMessage();
+    std::string headScripts();
+    std::string fileUrl(const std::string &file, bool &ok);
 
 public:
     size_t webuiWin();
@@ -87,12 +169,29 @@ public:
     void resize(int w, int h);
     void useBrowser(bool y);
     bool disconnected();
+    bool gone();
+    bool pageReady();
+    bool runWhenReady(const std::string &code);
+    bool invokeWhenReady(const std::string &call);
+    bool waitUntilReady(int timeout_ms);
+
+public:
+    JSON htmlPatch(const std::string &element_id, const std::string &html, bool &full);
+    void forgetAllHtml();
+    void setVirtualList(const std::string &element_id, VirtualListPtr l);
+    VirtualListPtr virtualList(const std::string &element_id);
     void setShowState(WebUiWindow_ShowState st);
     int showState();
 
 public:
     void setExecJs(ExecJs *e);
     int id() const;
+    void setId(int win);
+    int currentHandle();
+    bool detached();
+    void attach();
+    bool inBrowser();
+    WebUIWindow *parentWindow();
 
 public:
 #ifdef _WINDOWS
@@ -110,16 +209,29 @@ public:
     void handleWireEvent(webui_event_t *e);
     void handleResizeEvent(webui_event_t *e);
     void handleMoveEvent(webui_event_t *e);
+    void nativeGeometryChanged(int x, int y, int w, int h);
+    void flushNativeGeometry();
+#ifdef __linux
+    void clearGeometryFlushSource();
+#endif
     bool canClose();
     bool mayNavigate();
     const void *filesHandler(const char *file, int *length);
+    const void *assetHandler(const std::string &url_path, int *length);
+    const void *virtualHandler(VirtualFilePtr vf, int *length);
+    const void *dynamicHandler(const std::string &route, int timeout_ms, const std::string &url_path,
+                               int *length);
+    const void *bundleHandler(AssetBundlePtr bundle, const std::string &entry_path, const std::string &url_path,
+                              int *length);
 
 public:
     int setUrl(const std::string &u);
     int  setHtml(std::string url);
 
 public:
-    WebUIWindow(WebWireHandler *h, int _win, const std::string &profile, bool _use_browser, WebUIWindow *parent_win, Object_t *parent = nullptr);
+    WebUIWindow(WebWireHandler *h, int _win, const std::string &profile, bool _use_browser, WebUIWindow *parent_win,
+                Object_t *parent = nullptr, bool hidden = false, const WindowSpec_t *spec = nullptr,
+                int companion_of = -1);
     ~WebUIWindow();
 };
 
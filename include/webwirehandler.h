@@ -6,6 +6,7 @@
 #include "object_t.h"
 #include "variant_t.h"
 #include "event_t.h"
+#include "json.h"
 
 #include <filesystem>
 
@@ -15,7 +16,10 @@
 #define id_handler_log  "handler-log-event"
 #define evt_handler_log Event_t(id_handler_log, this)
 
+#define WINDOW_POOL_REFILL_MS   50      // Pooled windows are created one per tick, after 'new' has returned
+
 class WebUIWindow;
+class WindowSpec_t;
 class WebWireProfile;
 class HttpServer_t;
 class Application_t;
@@ -80,6 +84,7 @@ private:
     std::list<AtDelete_t *>           _to_inform_at_delete;
 
     int                                 _window_nr;
+    int                                 _hidden_nr;         // Pooled and prerendering windows count down from -1
     int                                 _code_handle;
     std::stringlist                     _reasons;
     std::stringlist                     _responses;
@@ -93,6 +98,19 @@ private:
 
     WebWireLogLevel_t                    _min_log_level;
 
+private:
+    wwhash<std::string, int>             _pool_sizes;        // profile -> number of warm windows to keep
+    wwhash<std::string, wwlist<int>>     _pool;              // profile -> hidden, pre-initialized windows
+    wwhash<int, std::string>             _pooled;            // window -> profile, while it is in the pool
+    Timer_t                             *_pool_timer;
+    bool                                 _pool_refill_scheduled;
+    unsigned long long                   _pool_hits;
+    unsigned long long                   _pool_misses;
+
+private:
+    wwhash<int, int>                     _prerenders;        // window -> hidden companion that prerenders for it
+    wwhash<int, int>                     _companions;        // companion -> window
+
     void (*_log_handler)(const char *kind, const char *msg, void *user_data);
     void (*_evt_handler)(const char *msg, void *user_data);
     void (*_log_f)(const char *msg);
@@ -102,6 +120,14 @@ private:
 private:
     void log(FILE *fh, FILE *log_fh, const char *format, const char *msg);
     std::stringlist splitArgs(std::string l, void log_f(const char *) = nullptr);
+    static std::string internalProfile(const std::string &profile);
+    int createWindow(const std::string &profile, bool in_browser, int parent_win_id, bool hidden,
+                     const WindowSpec_t *spec = nullptr, int companion_of = -1);
+    bool hostKnows(int win);
+    bool swappable(int win, std::string &error);
+    void renumberWindow(int from, int to);
+    void scheduleRefill();
+    void refillPool();
 
 public:
     void setLogLevel(WebWireLogLevel_t l);
@@ -135,7 +161,11 @@ public:
 
     // WebWire Command handling
 public:
-    int newWindow(const std::string &app_name, bool in_browser, int parent_win_id = -1);
+    int newWindow(const std::string &app_name, bool in_browser, int parent_win_id = -1, const WindowSpec_t *spec = nullptr);
+    void setWindowPool(const std::string &profile, int size);
+    int prerender(int win, const std::string &file, std::string &error);
+    int swapPrerendered(int win, std::string &error);
+    JSON windowPoolStats();
     bool closeWindow(int win);
     void debugWin(int win);
     bool moveWindow(int win, int x, int y);
@@ -153,6 +183,9 @@ public:
 
     void execJs(int win, const std::string &code, std::string tag = "exec-js");
     void execJs(int win, const std::string &code, bool &ok, std::string &result, std::string tag = "exec-js");
+    void invoke(int win, const std::string &fn, const JSON &args);
+    void invoke(int win, const std::string &fn, const JSON &args, bool &ok, std::string &result);
+    void definePageFunction(int win, const std::string &name, const std::string &function_code);
 
     // WebWire internal
 public:
@@ -3,6 +3,9 @@
 
 #include "object_t.h"
 #include <string>
+#include <mutex>
+#include "misc.h"
+#include "json.h"
 
 class WebWireHandler;
 
@@ -32,24 +35,14 @@ public:
 
 #define WEB_WIRE_PROFILE_WORLD_ID 425542
 
+// Virtual assets served from memory by webui-wire itself
+#define WEB_WIRE_ASSET_PREFIX   "/__webwire/"
+
 class WebWireProfile : public Object_t
 {
 private:
     std::string _profile_name;
 
-private:
-    std::string _set_html_name;
-    std::string _get_html_name;
-    std::string _set_attr_name;
-    std::string _get_attr_name;
-    std::string _get_attrs_name;
-    std::string _del_attr_name;
-    std::string _add_style_name;
-    std::string _set_style_name;
-    std::string _get_style_name;
-    std::string _set_css_name;
-    std::string _get_elements_name;
-
 private:
     int _world_id;
     std::string _css;
@@ -58,8 +51,19 @@ private:
     std::list<Script_t> _scripts;
 
 private:
-    void exec(WebWireHandler *h, int win, const std::string &name, const std::string &js);
-    void exec(WebWireHandler *h, int win, const std::string &name, const std::string &js, bool &ok, std::string &result);
+    Script_t _host_functions;
+    wwhash<std::string, std::string> _host_function_code;       // name -> function expression
+
+private:
+    std::mutex  _asset_mutex;
+    std::string _scripts_asset;
+    std::string _scripts_url;
+
+private:
+    void buildScriptsAsset();
+
+    void invoke(WebWireHandler *h, int win, const std::string &fn, const JSON &args);
+    void invoke(WebWireHandler *h, int win, const std::string &fn, const JSON &args, bool &ok, std::string &result);
 
 public:
     explicit WebWireProfile(const std::string &name, const std::string &default_css, Object_t *parent = nullptr);
@@ -70,10 +74,18 @@ public:
     int  usage();
     std::string profileName();
     std::string scriptsTag();
+    std::string scriptsUrl();
+    std::string scriptsAsset(std::string &url);
+    void setCss(const std::string &css);
+    void definePageFunction(const std::string &name, const std::string &function_code);
+    static std::string registerCode(const std::string &name, const std::string &function_code);
 
 public:
     void set_html(WebWireHandler *h, int win, int handle, const std::string &element_id, const std::string &html, bool fetch);
     std::string get_html(WebWireHandler *h, int win, const std::string &element_id, bool &ok);
+    void patch_html(WebWireHandler *h, int win, int handle, const std::string &element_id, const JSON &ops);
+    void insert_html(WebWireHandler *h, int win, const std::string &element_id, const std::string &position,
+                     const std::string &html, int max_children);
 
     void set_attr(WebWireHandler *h, int win, const std::string &element_id, const std::string &attr, const std::string &val);
     std::string get_attr(WebWireHandler *h, int win, const std::string &element_id, const std::string &attr, bool &ok);
@@ -87,6 +99,14 @@ public:
     void set_css(WebWireHandler *h, int win, const std::string &css);
 
     std::string get_elements(WebWireHandler *h, int win, const std::string &selector, bool &ok);
+
+    void virtual_list(WebWireHandler *h, int win, const std::string &element_id, const JSON &spec);
+    void set_rows(WebWireHandler *h, int win, const std::string &element_id, int from, const JSON &rows);
+    void set_row_count(WebWireHandler *h, int win, const std::string &element_id, int rows, bool reset);
+
+    void transaction(WebWireHandler *h, int win, int handle, const JSON &ops);
+    std::string query(WebWireHandler *h, int win, const JSON &requests, bool &ok);
+    static int transactionOpArgs(const std::string &op);     // Number of [id, args...] of an operation, -1 if unknown
 };
 
 #endif // WEBWIREPROFILE_H
@@ -0,0 +1,208 @@
+#include "assetbundle_t.h"
+#include "fileinfo_t.h"
+#include "statcache_t.h"
+
+#include <string.h>
+
+std::mutex AssetBundle_t::_mounts_mutex;
+wwhash<std::string, AssetBundlePtr> AssetBundle_t::_mounts;
+
+static unsigned long long getLE(const char *p, int bytes)
+{
+    const unsigned char *b = reinterpret_cast<const unsigned char *>(p);
+    unsigned long long v = 0;
+    for(int i = bytes - 1; i >= 0; i--) {
+        v = (v << 8) | b[i];
+    }
+    return v;
+}
+
+bool AssetBundle_t::open(const std::string &file, std::string &error)
+{
+    FileInfo_t fi(file);
+    if (!fi.exists() || !fi.isReadable()) {
+        error = "Cannot read bundle " + file;
+        return false;
+    }
+
+    size_t size = fi.size();
+    std::filesystem::file_time_type mtime = fi.lastModified();
+    if (size < ASSET_BUNDLE_HEADER_SIZE) {
+        error = "Not an asset bundle: " + file;
+        return false;
+    }
+
+    char d[ASSET_BUNDLE_HEADER_SIZE];
+    if (fi.read(0, ASSET_BUNDLE_HEADER_SIZE, d) != ASSET_BUNDLE_HEADER_SIZE) {
+        error = "Cannot read bundle " + file;
+        return false;
+    }
+    if (memcmp(d, ASSET_BUNDLE_MAGIC, ASSET_BUNDLE_MAGIC_SIZE) != 0) {
+        error = "Not an asset bundle: " + file;
+        return false;
+    }
+    if (getLE(d + 8, 4) != ASSET_BUNDLE_VERSION) {
+        error = "Unsupported asset bundle version in " + file;
+        return false;
+    }
+
+    size_t count = getLE(d + 12, 4);
+    size_t index_offset = getLE(d + 16, 8);
+    size_t index_size = getLE(d + 24, 8);
+    if (index_offset > size || index_size > size - index_offset) {
+        error = "Corrupt asset bundle index in " + file;
+        return false;
+    }
+
+    std::string index(index_size, '\0');
+    if (fi.read(index_offset, index_size, index.data()) != index_size) {
+        error = "Cannot read bundle " + file;
+        return false;
+    }
+
+    wwhash<std::string, AssetBundleEntry_t> entries;
+    const char *p = index.data();
+    const char *end = p + index_size;
+    for(size_t i = 0; i < count; i++) {
+        if (end - p < ASSET_BUNDLE_INDEX_FIXED) {
+            error = "Corrupt asset bundle index in " + file;
+            return false;
+        }
+        size_t path_len = getLE(p, 4);
+        size_t type_len = getLE(p + 4, 4);
+        size_t etag_len = getLE(p + 8, 4);
+        unsigned int flags = static_cast<unsigned int>(getLE(p + 12, 4));
+
+        AssetBundleEntry_t e;
+        e.offset = getLE(p + 16, 8);
+        e.size = getLE(p + 24, 8);
+        e.is_html = (flags & ASSET_BUNDLE_FLAG_HTML) != 0;
+        p += ASSET_BUNDLE_INDEX_FIXED;
+
+        if (static_cast<size_t>(end - p) < path_len + type_len + etag_len ||
+            e.offset > size || e.size > size - e.offset) {
+            error = "Corrupt asset bundle entry in " + file;
+            return false;
+        }
+        e.path = std::string(p, path_len);
+        p += path_len;
+        e.content_type = std::string(p, type_len);
+        p += type_len;
+        e.etag = std::string(p, etag_len);
+        p += etag_len;
+
+        entries[e.path] = e;
+    }
+
+    _file = file;
+    _size = size;
+    _file_mtime = mtime;
+    _mtime = FileInfo_t::toTime(mtime);
+    _entries = entries;
+
+    return true;
+}
+
+const AssetBundleEntry_t *AssetBundle_t::entry(const std::string &path)
+{
+    auto it = _entries.find(path);
+    if (it == _entries.end()) {
+        return nullptr;
+    }
+    return &it->second;
+}
+
+bool AssetBundle_t::unchanged()
+{
+    // The index only describes the file it was read from, a repacked bundle must be mounted again
+    FileStat_t st;
+    StatCache_t::shared().stat(_file, st);
+    return st.exists && st.size == _size && st.mtime == _file_mtime;
+}
+
+bool AssetBundle_t::read(size_t offset, size_t size, std::string &dest)
+{
+    dest.resize(size);
+    return unchanged() && FileInfo_t(_file).read(offset, size, dest.data()) == size;
+}
+
+std::string AssetBundle_t::file()
+{
+    return _file;
+}
+
+std::time_t AssetBundle_t::lastModified()
+{
+    return _mtime;
+}
+
+size_t AssetBundle_t::count()
+{
+    return _entries.size();
+}
+
+std::string AssetBundle_t::normalizedPrefix(const std::string &url_prefix)
+{
+    std::string prefix = trim_copy(url_prefix);
+    if (prefix.rfind("/", 0) != 0) {
+        prefix = "/" + prefix;
+    }
+    if (!prefix.ends_with("/")) {
+        prefix += "/";
+    }
+    return prefix;
+}
+
+bool AssetBundle_t::mount(const std::string &url_prefix, const std::string &file, std::string &error, size_t &count)
+{
+    AssetBundlePtr b = std::make_shared<AssetBundle_t>();
+    if (!b->open(file, error)) {
+        return false;
+    }
+    count = b->count();
+
+    _mounts_mutex.lock();
+    _mounts[normalizedPrefix(url_prefix)] = b;       // Requests in progress keep the previous bundle alive
+    _mounts_mutex.unlock();
+
+    return true;
+}
+
+bool AssetBundle_t::unmount(const std::string &url_prefix)
+{
+    _mounts_mutex.lock();
+    bool found = _mounts.erase(normalizedPrefix(url_prefix)) > 0;
+    _mounts_mutex.unlock();
+    return found;
+}
+
+AssetBundlePtr AssetBundle_t::find(const std::string &url_path, std::string &entry_path)
+{
+    AssetBundlePtr b;
+    size_t best = 0;
+
+    _mounts_mutex.lock();
+    for(auto &[prefix, bundle] : _mounts) {
+        if (prefix.size() > best && url_path.rfind(prefix, 0) == 0) {
+            best = prefix.size();
+            b = bundle;
+        } else if (prefix.size() > best && url_path == prefix.substr(0, prefix.size() - 1)) {
+            best = url_path.size();         // The bare prefix, e.g. /app for /app/
+            b = bundle;
+        }
+    }
+    _mounts_mutex.unlock();
+
+    if (b) {
+        if (best == url_path.size() && !url_path.ends_with("/")) {
+            entry_path = "";                // Needs a redirect to the prefix with its slash
+        } else {
+            entry_path = url_path.substr(best);
+            if (entry_path == "" || entry_path.ends_with("/")) {
+                entry_path += "index.html";
+            }
+        }
+    }
+
+    return b;
+}
@@ -0,0 +1,222 @@
+#include "dynamicroutes_t.h"
+#include "httpresponse_t.h"
+
+void DynamicRoutes_t::expire()
+{
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    for(auto it = _cache.begin(); it != _cache.end(); ) {
+        if (it->second->expires_at <= now) {
+            _cache_bytes -= it->second->data.size();
+            it = _cache.erase(it);
+        } else {
+            it++;
+        }
+    }
+}
+
+void DynamicRoutes_t::dropCached(const std::string &prefix)
+{
+    for(auto it = _cache.begin(); it != _cache.end(); ) {
+        if (it->first.rfind(prefix, 0) == 0) {
+            _cache_bytes -= it->second->data.size();
+            it = _cache.erase(it);
+        } else {
+            it++;
+        }
+    }
+}
+
+int DynamicRoutes_t::maxAge(const std::string &cache_control)
+{
+    std::string cc = lcase(cache_control);
+    if (cc.find("no-store") != std::string::npos || cc.find("no-cache") != std::string::npos) {
+        return -1;
+    }
+    size_t p = cc.find("s-maxage=");
+    if (p != std::string::npos) {
+        return atoi(cc.c_str() + p + 9);
+    }
+    p = cc.find("max-age=");
+    if (p != std::string::npos) {
+        return atoi(cc.c_str() + p + 8);
+    }
+    return -1;
+}
+
+void DynamicRoutes_t::addRoute(const std::string &prefix, int timeout_ms)
+{
+    std::string p = normalizedPrefix(prefix);
+    _mutex.lock();
+    _routes[p] = (timeout_ms > 0) ? timeout_ms : DYNAMIC_ROUTE_TIMEOUT_MS;
+    dropCached(p);          // Registering again means: the host's data changed
+    _mutex.unlock();
+}
+
+bool DynamicRoutes_t::removeRoute(const std::string &prefix)
+{
+    std::string p = normalizedPrefix(prefix);
+    _mutex.lock();
+    bool found = _routes.erase(p) > 0;
+    dropCached(p);
+    _mutex.unlock();
+    return found;
+}
+
+bool DynamicRoutes_t::route(const std::string &path, std::string &prefix, int &timeout_ms)
+{
+    bool found = false;
+
+    _mutex.lock();
+    for(auto &[p, timeout] : _routes) {
+        bool match = path.rfind(p, 0) == 0 || path == p.substr(0, p.size() - 1);   // Also /api for /api/
+        if (match && (!found || p.size() > prefix.size())) {                        // Longest prefix wins
+            prefix = p;
+            timeout_ms = timeout;
+            found = true;
+        }
+    }
+    _mutex.unlock();
+
+    return found;
+}
+
+DynamicResponsePtr DynamicRoutes_t::request(const std::string &path, int timeout_ms, std::function<void(int id)> send_request)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _requests += 1;
+
+    auto c = _cache.find(path);
+    if (c != _cache.end()) {
+        if (c->second->expires_at > std::chrono::steady_clock::now()) {
+            _hits += 1;
+            return c->second;
+        }
+        _cache_bytes -= c->second->data.size();
+        _cache.erase(c);
+    }
+
+    PendingPtr p;
+    if (_in_flight.contains(path)) {
+        p = _in_flight[path];
+        _coalesced += 1;
+    } else {
+        int id = ++_next_id;
+        p = std::make_shared<Pending_t>();
+        p->path = path;
+        p->id = id;
+        p->waiters = 0;
+        p->done = false;
+        _pending[id] = p;
+        _in_flight[path] = p;
+
+        lock.unlock();          // The host may answer from within the event callback
+        send_request(id);
+        lock.lock();
+    }
+    p->waiters += 1;
+
+    bool answered = _answered.wait_for(lock, std::chrono::milliseconds(timeout_ms), [&p]() { return p->done; });
+    p->waiters -= 1;
+    if (!answered) {
+        _timeouts += 1;
+        if (p->waiters == 0) {          // Others that joined later may still get the answer in time
+            _pending.erase(p->id);
+            if (_in_flight.contains(path) && _in_flight[path] == p) {
+                _in_flight.erase(path);
+            }
+        }
+        return DynamicResponsePtr();
+    }
+
+    return p->response;
+}
+
+bool DynamicRoutes_t::respond(int id, int code, const std::string &content_type, const std::string &cache_control,
+                              const std::string &data)
+{
+    std::shared_ptr<DynamicResponse_t> r = std::make_shared<DynamicResponse_t>();
+    r->code = code;
+    r->content_type = content_type;
+    r->cache_control = cache_control;
+    r->data = data;
+    r->etag = HttpResponse_t::etag(data);
+    r->modified = std::time(nullptr);
+    int age = maxAge(cache_control);
+    r->expires_at = std::chrono::steady_clock::now() + std::chrono::seconds((age > 0) ? age : 0);
+
+    _mutex.lock();
+    if (!_pending.contains(id)) {
+        _mutex.unlock();
+        return false;           // Unknown, or the request has timed out
+    }
+    PendingPtr p = _pending[id];
+    _pending.erase(id);
+    if (_in_flight.contains(p->path) && _in_flight[p->path] == p) {
+        _in_flight.erase(p->path);
+    }
+
+    if (age > 0 && data.size() <= DYNAMIC_ROUTE_CACHE_MAX_BYTES) {
+        expire();
+        if (_cache_bytes + data.size() > DYNAMIC_ROUTE_CACHE_MAX_BYTES) {
+            _cache.clear();
+            _cache_bytes = 0;
+        }
+        if (_cache.contains(p->path)) {
+            _cache_bytes -= _cache[p->path]->data.size();
+        }
+        _cache[p->path] = r;
+        _cache_bytes += data.size();
+    }
+
+    p->response = r;
+    p->done = true;
+    _mutex.unlock();
+
+    _answered.notify_all();
+    return true;
+}
+
+JSON DynamicRoutes_t::stats()
+{
+    JSON j;
+    _mutex.lock();
+    expire();
+    j["routes"] = _routes.size();
+    j["requests"] = _requests;
+    j["hits"] = _hits;
+    j["coalesced"] = _coalesced;
+    j["timeouts"] = _timeouts;
+    j["pending"] = _pending.size();
+    j["entries"] = _cache.size();
+    j["bytes"] = _cache_bytes;
+    _mutex.unlock();
+    return j;
+}
+
+std::string DynamicRoutes_t::normalizedPrefix(const std::string &prefix)
+{
+    std::string p = replace(trim_copy(prefix), "\\", "/");
+    if (p.rfind("/", 0) != 0) {
+        p = "/" + p;
+    }
+    if (!p.ends_with("/")) {
+        p += "/";
+    }
+    return p;
+}
+
+DynamicRoutes_t &DynamicRoutes_t::shared()
+{
+    static DynamicRoutes_t routes;
+    return routes;
+}
+
+DynamicRoutes_t::DynamicRoutes_t()
+{
+    _cache_bytes = 0;
+    _next_id = 0;
+    _requests = 0;
+    _hits = 0;
+    _coalesced = 0;
+    _timeouts = 0;
+}
@@ -71,7 +71,9 @@ void ExecJs::run(const std::string &code)
         return;
     }
 
-    webui_run(_webui_win, code.c_str());
+    if (!_window->runWhenReady(code)) {
+        _handler->error(asprintf("ExecJs:Window %d is disconnected, '%s' has not been run", _win, _name.c_str()));
+    }
 }
 
 #define MAX_JS_BUF (100 *1024)      // Max 100Kb Buffer
@@ -97,10 +99,39 @@ std::string ExecJs::call(const std::string &code, bool &ok)
                          "}";
 
     //ok = webui_script(_webui_win, code.c_str(), MAX_EXEC_TIME, buf, MAX_JS_BUF);
-    webui_run(_webui_win, script.c_str());
+    return waitForResult(code, [this, &script]() { webui_run(_webui_win, script.c_str()); return true; }, ok);
+}
 
-    _handler->message("webui_run called");
+static std::string rpcCall(const std::string &fn, const JSON &args, bool result)
+{
+    JSON c;
+    c["fn"] = fn;
+    c["args"] = args;
+    c["result"] = result;
+    return c.dump();
+}
+
+void ExecJs::invoke(const std::string &fn, const JSON &args)
+{
+    if (_webui_win == 0) {
+        _handler->error(asprintf("ExecJs:No WebUIWindow available for window %d to invoke %s", _win, fn.c_str()));
+        return;
+    }
 
+    if (!_window->invokeWhenReady(rpcCall(fn, args, false))) {
+        _handler->error(asprintf("ExecJs:Window %d is disconnected, '%s' has not been invoked", _win, fn.c_str()));
+    }
+}
+
+std::string ExecJs::invoke(const std::string &fn, const JSON &args, bool &ok)
+{
+    std::string call = rpcCall(fn, args, true);
+    _handler->message("invoking: " + call);
+    return waitForResult(fn, [this, &call]() { return _window->invokeWhenReady(call); }, ok);
+}
+
+std::string ExecJs::waitForResult(const std::string &code, std::function<bool()> send, bool &ok)
+{
     if (_is_void) {
         _handler->error("ExecJs:Calling code that has been declared void");
     }
@@ -108,22 +139,35 @@ std::string ExecJs::call(const std::string &code, bool &ok)
     if (_webui_win == 0) {
         _handler->error(asprintf("ExecJs:No WebUIWindow available for window %d to run this code in", _win));
         std::string s = asprintf("NOK:%d:%s:%s", _win, _name.c_str(), "Window not available (WebUIWindow for window gives nullptr)");
+        ok = false;
         return s;
     }
 
-    {
-        char buf[1024];
-        sprintf(buf, "Setting ExecJs on window %p", _window);
-        _handler->message("Setting ExecJs on the window");
+    // A page that is still loading would drop the script; wait for it, but not for a window that is gone.
+    if (!_window->waitUntilReady(PAGE_READY_TIMEOUT_MS)) {
+        _handler->error(asprintf("ExecJs:Window %d has no loaded page, '%s' has not been run", _win, _name.c_str()));
+        ok = false;
+        std::string s = "";
+        return s;
     }
 
-    _window->setExecJs(this);
-
     _result_set = false;
+    _window->setExecJs(this);       // Before running, the result may arrive right away
+
+    if (!send()) {
+        _handler->error(asprintf("ExecJs:Window %d is disconnected, '%s' has not been run", _win, _name.c_str()));
+        _window->setExecJs(nullptr);
+        ok = false;
+        std::string s = "";
+        return s;
+    }
+
+    _handler->message("webui_run called");
+
     WebUI_Utils u;
 
     _handler->message("Waiting for result");
-    WebUI_Utils::WaitResult r = u.waitUntil([this](){ return _result_set; }, MAX_EXEC_TIME * 1000);
+    WebUI_Utils::WaitResult r = u.waitUntil([this](){ return _result_set || !_window->pageReady(); }, MAX_EXEC_TIME * 1000);
 
     char buf[1024];
     sprintf(buf, "Result of waiting = %d", r);
@@ -132,6 +176,15 @@ std::string ExecJs::call(const std::string &code, bool &ok)
     if (r == WebUI_Utils::wu_timeout) {
         _handler->error("ExecJs: Timeout for code " + code);
         _window->setExecJs(nullptr);
+        ok = false;
+        std::string s = "";
+        return s;
+    }
+
+    if (!_result_set) {
+        _handler->error("ExecJs: Page unloaded before returning a result for code " + code);
+        _window->setExecJs(nullptr);
+        ok = false;
         std::string s = "";
         return s;
     }
@@ -148,9 +201,6 @@ std::string ExecJs::call(const std::string &code, bool &ok)
         std::string s = "";
         return s;
     }
-
-    std::string s = "";
-    return s;
 }
 
 void ExecJs::setResult(std::string result, bool ok, std::string msg)
@@ -0,0 +1,122 @@
+#include "filecache_t.h"
+
+FileCacheEntryPtr FileCache_t::lookup(const std::string &file, std::filesystem::file_time_type mtime, size_t size)
+{
+    FileCacheEntryPtr e;
+
+    _mutex.lock();
+    if (_entries.contains(file)) {
+        Slot_t &slot = _entries[file];
+        if (slot.entry->mtime == mtime && slot.entry->size == size) {
+            _lru.splice(_lru.begin(), _lru, slot.lru_it);
+            e = slot.entry;
+            _hits += 1;
+            _bytes_served += e->data.size();
+        } else {
+            evict(file);        // File has changed on disk
+            _misses += 1;
+        }
+    } else {
+        _misses += 1;
+    }
+    _mutex.unlock();
+
+    return e;
+}
+
+void FileCache_t::insert(FileCacheEntryPtr entry)
+{
+    _mutex.lock();
+    if (entry->data.size() > _max_entry_bytes || entry->data.size() > _max_bytes) {
+        _mutex.unlock();
+        return;
+    }
+    if (_entries.contains(entry->file)) {
+        evict(entry->file);
+    }
+    shrinkTo(_max_bytes - entry->data.size());
+
+    _lru.push_front(entry->file);
+    Slot_t slot = { entry, _lru.begin() };
+    _entries[entry->file] = slot;
+    _bytes += entry->data.size();
+    _mutex.unlock();
+}
+
+bool FileCache_t::cacheable(size_t size)
+{
+    return size <= _max_entry_bytes && size <= _max_bytes;
+}
+
+void FileCache_t::evict(const std::string &file)
+{
+    Slot_t &slot = _entries[file];
+    _bytes -= slot.entry->data.size();
+    _lru.erase(slot.lru_it);
+    _entries.erase(file);
+}
+
+void FileCache_t::shrinkTo(size_t max_bytes)
+{
+    while (_bytes > max_bytes && !_lru.empty()) {
+        std::string file = _lru.back();
+        evict(file);
+        _evictions += 1;
+    }
+}
+
+void FileCache_t::clear()
+{
+    _mutex.lock();
+    _entries.clear();
+    _lru.clear();
+    _bytes = 0;
+    _mutex.unlock();
+}
+
+void FileCache_t::setMaxBytes(size_t max_bytes)
+{
+    _mutex.lock();
+    _max_bytes = max_bytes;
+    shrinkTo(_max_bytes);
+    _mutex.unlock();
+}
+
+void FileCache_t::setMaxEntryBytes(size_t max_entry_bytes)
+{
+    _mutex.lock();
+    _max_entry_bytes = max_entry_bytes;
+    _mutex.unlock();
+}
+
+JSON FileCache_t::stats()
+{
+    JSON j;
+    _mutex.lock();
+    j["hits"] = _hits;
+    j["misses"] = _misses;
+    j["evictions"] = _evictions;
+    j["entries"] = _entries.size();
+    j["bytes"] = _bytes;
+    j["max-bytes"] = _max_bytes;
+    j["bytes-served"] = _bytes_served;
+    _mutex.unlock();
+    return j;
+}
+
+FileCache_t &FileCache_t::shared()
+{
+    static FileCache_t cache;
+    return cache;
+}
+
+FileCache_t::FileCache_t()
+{
+    _bytes = 0;
+    _max_bytes = FILE_CACHE_DEFAULT_MAX_BYTES;
+    _max_entry_bytes = FILE_CACHE_DEFAULT_MAX_ENTRY_BYTES;
+    _hits = 0;
+    _misses = 0;
+    _evictions = 0;
+    _bytes_served = 0;
+}
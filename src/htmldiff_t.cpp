@@ -0,0 +1,490 @@
+#include "htmldiff_t.h"
+
+#include <cctype>
+#include <cstring>
+#include <algorithm>
+
+static bool isOneOf(const std::string &name, std::initializer_list<const char *> names)
+{
+    for(const char *n : names) {
+        if (name == n) { return true; }
+    }
+    return false;
+}
+
+static bool isVoid(const std::string &tag)
+{
+    return isOneOf(tag, { "area", "base", "br", "col", "embed", "hr", "img", "input", "link", "meta",
+                          "source", "track", "wbr" });
+}
+
+static bool isRawText(const std::string &tag)
+{
+    return isOneOf(tag, { "script", "style", "textarea", "title", "xmp", "iframe", "noembed", "noframes" });
+}
+
+static bool closesP(const std::string &tag)
+{
+    return isOneOf(tag, { "address", "article", "aside", "blockquote", "details", "div", "dl", "fieldset",
+                          "figcaption", "figure", "footer", "form", "h1", "h2", "h3", "h4", "h5", "h6",
+                          "header", "hr", "main", "menu", "nav", "ol", "p", "pre", "section", "table", "ul" });
+}
+
+static std::string lower(const std::string &s)
+{
+    std::string r = s;
+    for(char &c : r) { c = static_cast<char>(tolower(static_cast<unsigned char>(c))); }
+    return r;
+}
+
+std::string HtmlNode_t::attr(const std::string &name) const
+{
+    for(auto &[k, v] : attrs) {
+        if (k == name) { return v; }
+    }
+    return "";
+}
+
+std::string HtmlNode_t::identity() const
+{
+    if (kind != element) {
+        return signature();
+    }
+    std::string key = attr("id");
+    if (key == "") { key = attr("data-key"); }
+    return tag + "#" + key;
+}
+
+std::string HtmlNode_t::signature() const
+{
+    if (kind == text) { return "#text"; }
+    if (kind == comment) { return "#comment"; }
+    return tag;
+}
+
+std::string HtmlNode_t::outerHtml() const
+{
+    if (kind == text) { return data; }
+    if (kind == comment) { return "<!--" + data + "-->"; }
+
+    std::string html = "<" + tag;
+    for(auto &[k, v] : attrs) {
+        html += " " + k + "=\"" + replace(v, "\"", "&quot;") + "\"";
+    }
+    if (foreign && children.empty()) {
+        return html + "/>";
+    }
+    html += ">";
+    if (isVoid(tag)) {
+        return html;
+    }
+    return html + innerHtml() + "</" + tag + ">";
+}
+
+std::string HtmlNode_t::innerHtml() const
+{
+    std::string html;
+    for(const HtmlNodePtr &c : children) {
+        html += c->outerHtml();
+    }
+    return html;
+}
+
+HtmlNode_t::HtmlNode_t(Kind k)
+{
+    kind = k;
+    foreign = false;
+}
+
+class HtmlParser_t
+{
+private:
+    const std::string          &_html;
+    size_t                      _pos;
+    std::vector<HtmlNodePtr>    _stack;
+
+private:
+    HtmlNodePtr top() { return _stack.back(); }
+
+    void addText(const std::string &t)
+    {
+        if (t.empty()) { return; }
+        HtmlNodePtr p = top();
+        if (!p->children.empty() && p->children.back()->kind == HtmlNode_t::text) {
+            p->children.back()->data += t;
+        } else {
+            HtmlNodePtr n = std::make_shared<HtmlNode_t>(HtmlNode_t::text);
+            n->data = t;
+            p->children.push_back(n);
+        }
+    }
+
+    HtmlNodePtr open(const std::string &tag)
+    {
+        HtmlNodePtr n = std::make_shared<HtmlNode_t>(HtmlNode_t::element);
+        n->tag = tag;
+        n->foreign = top()->foreign || tag == "svg" || tag == "math";
+        top()->children.push_back(n);
+        _stack.push_back(n);
+        return n;
+    }
+
+    // Pops up to and including the nearest open 'tag', unless one of 'boundaries' comes first
+    bool closeTo(std::initializer_list<const char *> tags, std::initializer_list<const char *> boundaries)
+    {
+        for(size_t i = _stack.size() - 1; i > 0; i--) {
+            const std::string &t = _stack[i]->tag;
+            if (isOneOf(t, tags)) {
+                _stack.resize(i);
+                return true;
+            }
+            if (isOneOf(t, boundaries)) {
+                return false;
+            }
+        }
+        return false;
+    }
+
+    void impliedEndTags(const std::string &tag)
+    {
+        if (top()->foreign) {
+            return;
+        }
+        if (closesP(tag)) {
+            closeTo({ "p" }, { "button", "table", "td", "th", "caption", "marquee", "object", "applet" });
+        }
+        if (tag == "li") {
+            closeTo({ "li" }, { "ul", "ol", "table", "td", "th" });
+        } else if (tag == "dt" || tag == "dd") {
+            closeTo({ "dt", "dd" }, { "dl", "table", "td", "th" });
+        } else if (tag == "option") {
+            if (top()->tag == "option") { _stack.pop_back(); }
+        } else if (tag == "optgroup") {
+            if (top()->tag == "option") { _stack.pop_back(); }
+            if (top()->tag == "optgroup") { _stack.pop_back(); }
+        } else if (tag == "tbody" || tag == "thead" || tag == "tfoot") {
+            closeTo({ "tbody", "thead", "tfoot" }, { "table" });
+        } else if (tag == "tr") {
+            closeTo({ "tr" }, { "table", "tbody", "thead", "tfoot" });
+            if (top()->tag == "table") { open("tbody"); }
+        } else if (tag == "td" || tag == "th") {
+            closeTo({ "td", "th" }, { "tr", "table" });
+            if (top()->tag == "table") { open("tbody"); }
+            if (isOneOf(top()->tag, { "tbody", "thead", "tfoot" })) { open("tr"); }
+        } else if (tag == "col") {
+            if (top()->tag == "table") { open("colgroup"); }
+        }
+    }
+
+    bool startsWith(const char *s)
+    {
+        return _html.compare(_pos, strlen(s), s) == 0;
+    }
+
+    void skipSpace()
+    {
+        while (_pos < _html.size() && isspace(static_cast<unsigned char>(_html[_pos]))) { _pos++; }
+    }
+
+    void parseStartTag()
+    {
+        size_t b = ++_pos;
+        while (_pos < _html.size() && !isspace(static_cast<unsigned char>(_html[_pos])) &&
+               _html[_pos] != '>' && _html[_pos] != '/') {
+            _pos++;
+        }
+        std::string tag = lower(_html.substr(b, _pos - b));
+
+        std::vector<std::pair<std::string, std::string>> attrs;
+        bool self_closing = false;
+        while (_pos < _html.size()) {
+            skipSpace();
+            if (_pos >= _html.size()) { break; }
+            char c = _html[_pos];
+            if (c == '>') { _pos++; break; }
+            if (c == '/') {
+                _pos++;
+                if (_pos < _html.size() && _html[_pos] == '>') { self_closing = true; _pos++; break; }
+                continue;
+            }
+            size_t nb = _pos;
+            while (_pos < _html.size() && !isspace(static_cast<unsigned char>(_html[_pos])) &&
+                   _html[_pos] != '>' && _html[_pos] != '=' && _html[_pos] != '/') {
+                _pos++;
+            }
+            std::string name = lower(_html.substr(nb, _pos - nb));
+            std::string value;
+            skipSpace();
+            if (_pos < _html.size() && _html[_pos] == '=') {
+                _pos++;
+                skipSpace();
+                if (_pos < _html.size() && (_html[_pos] == '"' || _html[_pos] == '\'')) {
+                    char q = _html[_pos++];
+                    size_t e = _html.find(q, _pos);
+                    if (e == std::string::npos) { e = _html.size(); }
+                    value = _html.substr(_pos, e - _pos);
+                    _pos = (e < _html.size()) ? e + 1 : e;
+                } else {
+                    size_t vb = _pos;
+                    while (_pos < _html.size() && !isspace(static_cast<unsigned char>(_html[_pos])) && _html[_pos] != '>') {
+                        _pos++;
+                    }
+                    value = _html.substr(vb, _pos - vb);
+                }
+            }
+            bool dup = false;
+            for(auto &[k, v] : attrs) { if (k == name) { dup = true; } }
+            if (!dup) {                 // The first one wins, as in browsers
+                attrs.push_back(std::pair<std::string, std::string>(name, value));
+            }
+        }
+
+        impliedEndTags(tag);
+        HtmlNodePtr n = open(tag);
+        n->attrs = attrs;
+
+        if (isVoid(tag) || (self_closing && n->foreign)) {
+            _stack.pop_back();
+        } else if (isRawText(tag) && !n->foreign) {
+            std::string lhtml_end = "</" + tag;
+            size_t e = _pos;
+            while (e < _html.size()) {
+                e = _html.find("</", e);
+                if (e == std::string::npos) { e = _html.size(); break; }
+                if (lower(_html.substr(e, lhtml_end.size())) == lhtml_end) { break; }
+                e += 2;
+            }
+            std::string content = _html.substr(_pos, e - _pos);
+            if (tag == "textarea" && !content.empty() && content[0] == '\n') {
+                content = content.substr(1);
+            }
+            addText(content);
+            _pos = _html.find('>', e);
+            _pos = (_pos == std::string::npos) ? _html.size() : _pos + 1;
+            _stack.pop_back();
+        } else if (tag == "pre" && _pos < _html.size() && _html[_pos] == '\n') {
+            _pos++;                     // A newline right after <pre> is dropped
+        }
+    }
+
+    void parseEndTag()
+    {
+        _pos += 2;
+        size_t b = _pos;
+        while (_pos < _html.size() && _html[_pos] != '>' && !isspace(static_cast<unsigned char>(_html[_pos]))) {
+            _pos++;
+        }
+        std::string tag = lower(_html.substr(b, _pos - b));
+        _pos = _html.find('>', _pos);
+        _pos = (_pos == std::string::npos) ? _html.size() : _pos + 1;
+
+        for(size_t i = _stack.size() - 1; i > 0; i--) {
+            if (_stack[i]->tag == tag) {
+                _stack.resize(i);
+                return;
+            }
+        }
+        // A stray end tag is ignored
+    }
+
+public:
+    HtmlNodePtr parse()
+    {
+        HtmlNodePtr root = std::make_shared<HtmlNode_t>(HtmlNode_t::element);
+        _stack.push_back(root);
+
+        size_t text_begin = _pos;
+        while (_pos < _html.size()) {
+            if (_html[_pos] != '<' || _pos + 1 >= _html.size()) {
+                _pos++;
+                continue;
+            }
+            char c = _html[_pos + 1];
+            bool markup = isalpha(static_cast<unsigned char>(c)) || c == '!' || c == '?' ||
+                          (c == '/' && _pos + 2 < _html.size() && isalpha(static_cast<unsigned char>(_html[_pos + 2])));
+            if (!markup) {
+                _pos++;
+                continue;
+            }
+
+            addText(_html.substr(text_begin, _pos - text_begin));
+
+            if (startsWith("<!--")) {
+                size_t e = _html.find("-->", _pos + 4);
+                HtmlNodePtr n = std::make_shared<HtmlNode_t>(HtmlNode_t::comment);
+                n->data = _html.substr(_pos + 4, ((e == std::string::npos) ? _html.size() : e) - _pos - 4);
+                top()->children.push_back(n);
+                _pos = (e == std::string::npos) ? _html.size() : e + 3;
+            } else if (c == '!' || c == '?') {
+                size_t e = _html.find('>', _pos);     // Doctype or processing instruction
+                _pos = (e == std::string::npos) ? _html.size() : e + 1;
+            } else if (c == '/') {
+                parseEndTag();
+            } else {
+                parseStartTag();
+            }
+            text_begin = _pos;
+        }
+        addText(_html.substr(text_begin));
+
+        return root;
+    }
+
+public:
+    HtmlParser_t(const std::string &html) : _html(html) { _pos = 0; }
+};
+
+HtmlNodePtr HtmlDiff_t::parse(const std::string &html)
+{
+    HtmlParser_t p(html);
+    return p.parse();
+}
+
+static JSON childPath(const JSON &path, int index)
+{
+    JSON p = path;
+    p.append(index);
+    return p;
+}
+
+void HtmlDiff_t::diffNode(const HtmlNodePtr &from, const HtmlNodePtr &to, const JSON &path,
+                          JSON &updates, JSON &removes, JSON &inserts)
+{
+    if (from->kind != HtmlNode_t::element) {
+        if (from->data != to->data) {
+            updates.append(Array(std::string("text"), path, from->signature(), to->data));
+        }
+        return;
+    }
+
+    if (isRawText(from->tag) && !from->foreign) {
+        if (from->attrs != to->attrs || from->innerHtml() != to->innerHtml()) {
+            updates.append(Array(std::string("replace"), path, from->signature(), to->outerHtml()));
+        }
+        return;
+    }
+
+    JSON set = JSON::Make(JSON::Class::Object);
+    JSON del = JSON::Make(JSON::Class::Array);
+    bool changed = false;
+    for(auto &[k, v] : to->attrs) {
+        bool same = false;
+        for(auto &[fk, fv] : from->attrs) { if (fk == k) { same = (fv == v); break; } }
+        if (!same) { set[k] = v; changed = true; }
+    }
+    for(auto &[fk, fv] : from->attrs) {
+        bool kept = false;
+        for(auto &[k, v] : to->attrs) { if (k == fk) { kept = true; break; } }
+        if (!kept) { del.append(fk); changed = true; }
+    }
+    if (changed) {
+        updates.append(Array(std::string("attrs"), path, from->signature(), set, del));
+    }
+
+    diffChildren(from, to, path, updates, removes, inserts);
+}
+
+void HtmlDiff_t::diffChildren(const HtmlNodePtr &from, const HtmlNodePtr &to, const JSON &path,
+                              JSON &updates, JSON &removes, JSON &inserts)
+{
+    const std::vector<HtmlNodePtr> &a = from->children;
+    const std::vector<HtmlNodePtr> &b = to->children;
+    size_t na = a.size();
+    size_t nb = b.size();
+
+    // match_a[i] is the index in b that a[i] is kept as, or -1
+    std::vector<int> match_a(na, -1);
+    std::vector<bool> matched_b(nb, false);
+
+    size_t pre = 0;
+    while (pre < na && pre < nb && a[pre]->identity() == b[pre]->identity()) {
+        match_a[pre] = static_cast<int>(pre);
+        matched_b[pre] = true;
+        pre++;
+    }
+    size_t post = 0;
+    while (post < na - pre && post < nb - pre && a[na - 1 - post]->identity() == b[nb - 1 - post]->identity()) {
+        match_a[na - 1 - post] = static_cast<int>(nb - 1 - post);
+        matched_b[nb - 1 - post] = true;
+        post++;
+    }
+
+    size_t ma = na - pre - post;
+    size_t mb = nb - pre - post;
+    if (ma > 0 && mb > 0) {
+        if (ma * mb <= HTML_DIFF_MAX_LCS_CELLS) {
+            // Longest common subsequence of identities over the middle part
+            std::vector<unsigned> lcs((ma + 1) * (mb + 1), 0);
+            auto at = [&lcs, mb](size_t i, size_t j) -> unsigned & { return lcs[i * (mb + 1) + j]; };
+            for(size_t i = ma; i-- > 0; ) {
+                for(size_t j = mb; j-- > 0; ) {
+                    if (a[pre + i]->identity() == b[pre + j]->identity()) {
+                        at(i, j) = at(i + 1, j + 1) + 1;
+                    } else {
+                        at(i, j) = std::max(at(i + 1, j), at(i, j + 1));
+                    }
+                }
+            }
+            size_t i = 0, j = 0;
+            while (i < ma && j < mb) {
+                if (a[pre + i]->identity() == b[pre + j]->identity()) {
+                    match_a[pre + i] = static_cast<int>(pre + j);
+                    matched_b[pre + j] = true;
+                    i++; j++;
+                } else if (at(i + 1, j) >= at(i, j + 1)) {
+                    i++;
+                } else {
+                    j++;
+                }
+            }
+        } else {
+            for(size_t k = 0; k < ma && k < mb; k++) {
+                if (a[pre + k]->identity() == b[pre + k]->identity()) {
+                    match_a[pre + k] = static_cast<int>(pre + k);
+                    matched_b[pre + k] = true;
+                }
+            }
+        }
+    }
+
+    bool structural = (na != nb);
+    for(size_t i = 0; i < na; i++) {
+        if (match_a[i] < 0) { structural = true; }
+    }
+    if (structural) {
+        updates.append(Array(std::string("count"), path, static_cast<int>(na)));
+    }
+
+    for(size_t i = 0; i < na; i++) {
+        if (match_a[i] >= 0) {
+            diffNode(a[i], b[match_a[i]], childPath(path, static_cast<int>(i)), updates, removes, inserts);
+        } else {
+            removes.append(Array(std::string("remove"), childPath(path, static_cast<int>(i)), a[i]->signature()));
+        }
+    }
+
+    for(size_t j = 0; j < nb; ) {
+        if (matched_b[j]) { j++; continue; }
+        size_t first = j;
+        std::string html;
+        while (j < nb && !matched_b[j]) {
+            html += b[j]->outerHtml();
+            j++;
+        }
+        inserts.append(Array(std::string("insert"), path, static_cast<int>(first), html));
+    }
+}
+
+JSON HtmlDiff_t::diff(const HtmlNodePtr &from, const HtmlNodePtr &to)
+{
+    JSON updates = JSON::Make(JSON::Class::Array);
+    JSON removes = JSON::Make(JSON::Class::Array);
+    JSON inserts = JSON::Make(JSON::Class::Array);
+    JSON root = JSON::Make(JSON::Class::Array);
+
+    diffChildren(from, to, root, updates, removes, inserts);
+
+    for(auto &op : removes.ArrayRange()) { updates.append(op); }
+    for(auto &op : inserts.ArrayRange()) { updates.append(op); }
+    return updates;
+}
@@ -1,12 +1,19 @@
 #include "httpresponse_t.h"
 #include "mimetypes_t.h"
 #include "fileinfo_t.h"
+#include "statcache_t.h"
 #include "webwirehandler.h"
 
 extern "C" {
 #include "webui.h"
 }
 
+std::mutex HttpResponse_t::_policy_mutex;
+wwhash<std::string, std::string> HttpResponse_t::_cache_control;
+
+static const char *day_names[] = { "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat" };
+static const char *month_names[] = { "Jan", "Feb", "Mar", "Apr", "May", "Jun",
+                                     "Jul", "Aug", "Sep", "Oct", "Nov", "Dec" };
 
 void HttpResponse_t::setResponseCode(int code)
 {
@@ -28,17 +35,114 @@ void HttpResponse_t::setContent(const std::string &content)
     _content = content;
 }
 
+void HttpResponse_t::setCachePolicy(const std::string &policy)
+{
+    // No policy, no header: the browser's own heuristics apply, as for any plain http server
+    if (policy != "") {
+        _headers["Cache-Control"] = policy;
+    }
+}
+
 void HttpResponse_t::setFile(const std::string &file)
 {
     _file = file;
     FileInfo_t fi(_file);
+    FileStat_t st;
+    StatCache_t::shared().stat(_file, st);
     setContentType(contentTypeForFileExt(fi.ext()));
+    setValidators(etag(st.mtime, st.size), FileInfo_t::toTime(st.mtime));
+}
+
+void HttpResponse_t::setFilePart(const std::string &file, size_t offset, size_t size)
+{
+    // e.g. an entry of an asset bundle, content type and validators are set by the caller
+    _file = file;
+    _file_part = true;
+    _file_offset = offset;
+    _file_size = size;
+}
+
+void HttpResponse_t::setValidators(const std::string &etag, std::time_t last_modified)
+{
+    if (etag != "") {
+        _headers["ETag"] = etag;
+    }
+    if (last_modified > 0) {
+        _headers["Last-Modified"] = httpDate(last_modified);
+    }
+}
+
+std::string HttpResponse_t::httpDate(std::time_t t)
+{
+    long long days = t / 86400;
+    long long secs = t % 86400;
+
+    // civil from days
+    long long z = days + 719468;
+    long long era = ((z >= 0) ? z : z - 146096) / 146097;
+    long long doe = z - era * 146097;
+    long long yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    long long doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    long long mp = (5 * doy + 2) / 153;
+    int d = static_cast<int>(doy - (153 * mp + 2) / 5 + 1);
+    int m = static_cast<int>((mp < 10) ? mp + 3 : mp - 9);
+    int y = static_cast<int>(yoe + era * 400 + ((m <= 2) ? 1 : 0));
+    int wday = static_cast<int>((days + 4) % 7);    // 1970-01-01 was a thursday
+
+    return asprintf("%s, %02d %s %04d %02d:%02d:%02d GMT",
+                    day_names[wday], d, month_names[m - 1], y,
+                    static_cast<int>(secs / 3600), static_cast<int>((secs / 60) % 60), static_cast<int>(secs % 60)
+                    );
+}
+
+std::string HttpResponse_t::etag(std::filesystem::file_time_type mtime, size_t size)
+{
+    unsigned long long ticks = static_cast<unsigned long long>(mtime.time_since_epoch().count());
+    return asprintf("\"%llx-%llx\"", ticks, static_cast<unsigned long long>(size));
+}
+
+std::string HttpResponse_t::etag(const std::string &content)
+{
+    return asprintf("\"%016llx\"", fnv1a64(content));
+}
+
+void HttpResponse_t::setCacheControl(const std::string &path_prefix, const std::string &policy)
+{
+    _policy_mutex.lock();
+    if (policy == "") {
+        _cache_control.erase(path_prefix);
+    } else {
+        _cache_control[path_prefix] = policy;
+    }
+    _policy_mutex.unlock();
+}
+
+std::string HttpResponse_t::cacheControl(const std::string &path)
+{
+    // Longest matching prefix wins. Without a policy no Cache-Control is sent: the files
+    // handler gets no request headers and cannot answer a 304, so 'no-cache' would only
+    // make every asset a full refetch.
+    std::string policy;
+    size_t best = 0;
+    _policy_mutex.lock();
+    for(auto &[prefix, p] : _cache_control) {
+        if (prefix.size() >= best && path.rfind(prefix, 0) == 0) {
+            best = prefix.size();
+            policy = p;
+        }
+    }
+    _policy_mutex.unlock();
+    return policy;
 }
 
 std::string HttpResponse_t::contentTypeForFileExt(std::string ext)
 {
-    MimeTypes_t mimes(_handler);
-    return mimes.mimetypeByExt(ext);
+    std::string_view mimetype = MimeTypes_t::mimetypeByExt(ext);
+    if (mimetype.empty()) {
+        _handler->error("Unknown mimetype for extension " + ext + ", defaulting to text/plain");
+        return "text/plain";
+    }
+    return std::string(mimetype);
 }
 
 std::string HttpResponse_t::codeText(int code)
@@ -112,10 +216,8 @@ std::string HttpResponse_t::codeText(int code)
     }
 }
 
-const char *HttpResponse_t::response(int &content_length)
+std::string HttpResponse_t::header(size_t content_size)
 {
-    // Allocate with webui_malloc, this will make webui automagically deallocate
-    // and when we go out of scope there will be no damage.
     std::string header;
     wwlist<std::string> keys = _headers.keys();
     std::stringlist::const_iterator it;
@@ -123,16 +225,40 @@ const char *HttpResponse_t::response(int &content_length)
         header += *it + ": " + _headers[*it] + "\r\n";
     }
 
-    int size = _content.size();
-    if (_file != "") {
-        FileInfo_t fi(_file);
-        size = fi.size();
-    }
-
     header = asprintf("HTTP/1.1 %d %s\r\n", _code, HttpResponse_t::codeText(_code).c_str()) +
              header +
-             asprintf("Content-length: %d\r\n", size) +
+             asprintf("Content-length: %llu\r\n", static_cast<unsigned long long>(content_size)) +
              "\r\n";
+    return header;
+}
+
+const char *HttpResponse_t::response(int &content_length)
+{
+    // Allocate with webui_malloc, this will make webui automagically deallocate
+    // and when we go out of scope there will be no damage.
+    size_t size = _content.size();
+    size_t offset = 0;
+    if (_file != "" && _file_part) {
+        offset = _file_offset;
+        size = _file_size;
+    } else if (_file != "") {
+        FileStat_t st;
+        StatCache_t::shared().stat(_file, st);
+        size = st.size;
+    }
+
+    if (size > HTTP_MAX_BODY_SIZE) {
+        _handler->error(asprintf("Cannot serve %llu bytes in one response: %s",
+                                 static_cast<unsigned long long>(size), _file.c_str()));
+        _code = 500;
+        _headers.clear();
+        _headers["Content-Type"] = "text/plain";
+        _content = "Too large to serve: " + _file;
+        _file = "";
+        size = _content.size();
+    }
+
+    std::string header = this->header(size);
 
     //_handler->message(header);
 
@@ -141,22 +267,49 @@ const char *HttpResponse_t::response(int &content_length)
     char *content = &resp[header.size()];
 
     if (_file != "") {
-        FILE *f;
-#ifdef _WINDOWS
-        fopen_s(&f, _file.c_str(), "rb");
-#else
-        f = fopen(_file.c_str(), "rb");
-#endif
-        fread(content, size, 1, f);
-        fclose(f);
-        content[size] = '\0';
+        // Read straight into the buffer webui sends, a short read (e.g. a truncated file) leaves zeros
+        size_t n = FileInfo_t(_file).read(offset, size, content);
+        memset(content + n, 0, size - n + 1);
     } else {
         memcpy(content, _content.c_str(), size);
         content[size] = '\0';
     }
 
-    content_length = size + header.size();
+    content_length = static_cast<int>(size + header.size());
+
+    return resp;
+}
 
+const char *HttpResponse_t::injectedResponse(const char *body, size_t body_size, size_t at, const std::string &insert, int &length)
+{
+    // Writes header, body[0, at), insert and body[at, ...) in one pass into the
+    // buffer that webui will free, without building the injected body first.
+    size_t size = body_size + insert.size();
+    std::string header = this->header(size);
+
+    char *resp = static_cast<char *>(webui_malloc(header.size() + size + 1));
+    char *p = resp;
+    memcpy(p, header.data(), header.size());
+    p += header.size();
+    memcpy(p, body, at);
+    p += at;
+    memcpy(p, insert.data(), insert.size());
+    p += insert.size();
+    memcpy(p, body + at, body_size - at);
+    p += body_size - at;
+    *p = '\0';
+
+    length = static_cast<int>(header.size() + size);
+    return resp;
+}
+
+const char *HttpResponse_t::response(const std::string &http_response, int &length)
+{
+    // A complete, prebuilt response (e.g. from the FileCache_t)
+    char *resp = static_cast<char *>(webui_malloc(http_response.size() + 1));
+    memcpy(resp, http_response.data(), http_response.size());
+    resp[http_response.size()] = '\0';
+    length = http_response.size();
     return resp;
 }
 
@@ -166,4 +319,7 @@ HttpResponse_t::HttpResponse_t(WebWireHandler *h, int code)
     _http_response_size = 0;
     _http_response = nullptr;
     _handler = h;
+    _file_part = false;
+    _file_offset = 0;
+    _file_size = 0;
 }
@@ -99,6 +99,49 @@ void focus_window_apple(void *c_window)
   //[window makeKeyAndOrderFront:nil];
 }
 
+void show_window_apple(void *c_window, bool show)
+{
+  NSWindow *window = (NSWindow *) c_window;
+  runOnMainQueueWithoutDeadlocking(^{
+    if (show) {
+      [window makeKeyAndOrderFront:window];
+    } else {
+      [window orderOut:window];
+    }
+  });
+}
+
+void set_window_title_apple(void *c_window, const char *title)
+{
+  NSWindow *window = (NSWindow *) c_window;
+  NSString *ns_title = [NSString stringWithUTF8String:title];
+  runOnMainQueueWithoutDeadlocking(^{
+    [window setTitle:ns_title];
+  });
+}
+
+void watch_window_geometry_apple(void *c_window, void (*cb)(size_t id, int x, int y, int w, int h), size_t id)
+{
+  NSWindow *window = (NSWindow *) c_window;
+
+  void (^report)(NSNotification *) = ^(NSNotification *note) {
+    NSRect frame = [window frame];
+    NSRect screen = [[window screen] frame];
+    // Cocoa has its origin bottom left, webui-wire uses top left
+    int x = (int) frame.origin.x;
+    int y = (int) (screen.size.height - frame.origin.y - frame.size.height);
+    cb(id, x, y, (int) frame.size.width, (int) frame.size.height);
+  };
+
+  NSNotificationCenter *center = [NSNotificationCenter defaultCenter];
+  [center addObserverForName:NSWindowDidMoveNotification object:window queue:nil usingBlock:report];
+  [center addObserverForName:NSWindowDidEndLiveResizeNotification object:window queue:nil usingBlock:report];
+  [center addObserverForName:NSWindowDidResizeNotification object:window queue:nil
+                  usingBlock:^(NSNotification *note) {
+    if (![window inLiveResize]) { report(note); }
+  }];
+}
+
 void init_app_apple()
 {
   [NSApplication sharedApplication];
@@ -1,6 +1,7 @@
 #include "fileinfo_t.h"
 
 #include <iostream>
+#include <cstdio>
 
 bool FileInfo_t::exists()
 {
@@ -27,6 +28,42 @@ size_t FileInfo_t::size()
     return s;
 }
 
+std::filesystem::file_time_type FileInfo_t::lastModified()
+{
+    std::error_code ec;
+    std::filesystem::file_time_type t = std::filesystem::last_write_time(_p, ec);
+    return t;
+}
+
+size_t FileInfo_t::read(size_t offset, size_t n, char *dest)
+{
+    // Reads n bytes from offset, returns how many there were
+    std::string file = _p.string();
+    FILE *f;
+#ifdef _WINDOWS
+    fopen_s(&f, file.c_str(), "rb");
+#else
+    f = fopen(file.c_str(), "rb");
+#endif
+    if (f == nullptr) {
+        return 0;
+    }
+#ifdef _WINDOWS
+    int r = _fseeki64(f, static_cast<long long>(offset), SEEK_SET);
+#else
+    int r = fseeko(f, static_cast<off_t>(offset), SEEK_SET);
+#endif
+    size_t got = (r == 0) ? fread(dest, 1, n, f) : 0;
+    fclose(f);
+    return got;
+}
+
+std::time_t FileInfo_t::toTime(std::filesystem::file_time_type t)
+{
+    std::chrono::system_clock::time_point st = std::chrono::file_clock::to_sys(t);
+    return std::chrono::system_clock::to_time_t(st);
+}
+
 bool FileInfo_t::mkPath()
 {
     std::error_code ec;
@@ -21,7 +21,15 @@ std::string json_escape(const string &str) {
         case '\n': output += "\\n";  break;
         case '\r': output += "\\r";  break;
         case '\t': output += "\\t";  break;
-        default  : output += str[i]; break;
+        default  :
+            if (static_cast<unsigned char>(str[i]) < 0x20) {      // JSON.parse() rejects raw control characters
+                char buf[8];
+                snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned char>(str[i]));
+                output += buf;
+            } else {
+                output += str[i];
+            }
+            break;
         }
     return std::move( output );
 }
@@ -123,6 +131,13 @@ string JSON::toString(bool &ok) const {
     return ok ? std::move( json_escape( *Internal.String ) ): string("");
 }
 
+string JSON::toRawString() const { bool b; return toRawString( b ); }
+
+string JSON::toRawString(bool &ok) const {
+    ok = (Type == Class::String);
+    return ok ? *Internal.String : string("");
+}
+
 double JSON::toFloat() const { bool b; return toFloat( b ); }
 
 double JSON::toFloat(bool &ok) const {
@@ -110,3 +110,31 @@ void terminateThread(std::thread *thr)
   TerminateThread(thr->native_handle(), 0);
 #endif
 }
+
+bool base64_decode(const std::string &in, std::string &out)
+{
+    static const std::string chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    out.clear();
+    out.reserve(in.size() / 4 * 3);
+
+    unsigned int bits = 0;
+    int nbits = 0;
+    for(char c : in) {
+        if (c == '=' || is_space(c)) {
+            continue;
+        }
+        size_t v = chars.find(c);
+        if (v == std::string::npos) {
+            if (c == '-') { v = 62; }           // url safe alphabet
+            else if (c == '_') { v = 63; }
+            else { return false; }
+        }
+        bits = (bits << 6) | static_cast<unsigned int>(v);
+        nbits += 6;
+        if (nbits >= 8) {
+            nbits -= 8;
+            out += static_cast<char>((bits >> nbits) & 0xff);
+        }
+    }
+    return true;
+}
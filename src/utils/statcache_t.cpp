@@ -0,0 +1,315 @@
+#include "statcache_t.h"
+
+#ifdef __linux
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+void StatCache_t::statPath(const std::string &path, FileStat_t &st)
+{
+    std::error_code ec;
+    std::filesystem::file_status s = std::filesystem::status(path, ec);
+
+    st.exists = !ec && std::filesystem::exists(s);
+    st.readable = st.exists && (s.permissions() & std::filesystem::perms::owner_read) != std::filesystem::perms::none;
+    st.is_dir = st.exists && std::filesystem::is_directory(s);
+    st.size = 0;
+    st.mtime = std::filesystem::file_time_type();
+
+    if (st.exists && !st.is_dir) {
+        st.size = std::filesystem::file_size(path, ec);
+        if (ec) { st.size = 0; }
+    }
+    if (st.exists) {
+        st.mtime = std::filesystem::last_write_time(path, ec);
+    }
+}
+
+int StatCache_t::watch(const std::string &path, std::string &name)
+{
+#ifdef __linux
+    if (_inotify_fd < 0) {
+        return -1;
+    }
+
+    std::filesystem::path p(path);
+    std::string dir = p.parent_path().string();
+    name = p.filename().string();
+    if (dir == "") { dir = "."; }
+
+    int wd;
+    if (_dir_watches.contains(dir)) {
+        wd = _dir_watches[dir];
+    } else {
+        wd = inotify_add_watch(_inotify_fd, dir.c_str(),
+                               IN_ATTRIB | IN_MODIFY | IN_CLOSE_WRITE | IN_CREATE | IN_DELETE |
+                               IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF);
+        if (wd < 0) {
+            return -1;      // e.g. the directory does not exist, or out of watches
+        }
+        _dir_watches[dir] = wd;
+    }
+    _dir_refs[wd] += 1;         // Given back by release() when the entry goes
+
+    std::stringlist &keys = _watched_names[wd][name];
+    if (std::find(keys.begin(), keys.end(), path) == keys.end()) {
+        keys.push_back(path);
+    }
+    return wd;
+#else
+    (void) path;
+    (void) name;
+    return -1;
+#endif
+}
+
+size_t StatCache_t::drop(const std::string &path)
+{
+    auto it = _entries.find(path);
+    if (it == _entries.end()) {
+        return 0;
+    }
+
+    Entry_t &e = it->second;
+    _lru.erase(e.lru_it);
+    if (e.wd >= 0 && _watched_names.contains(e.wd)) {
+        wwhash<std::string, std::stringlist> &names = _watched_names[e.wd];
+        if (names.contains(e.name)) {
+            names[e.name].remove(path);
+            if (names[e.name].empty()) {
+                names.erase(e.name);
+            }
+        }
+    }
+    int wd = e.wd;
+    _entries.erase(it);
+    release(wd);
+    return 1;
+}
+
+void StatCache_t::release(int wd)
+{
+    // The last entry under a directory takes the watch along, so directories that
+    // were looked at once do not use up the inotify watch limit
+    if (wd < 0 || !_dir_refs.contains(wd)) {
+        return;
+    }
+    _dir_refs[wd] -= 1;
+    if (_dir_refs[wd] > 0) {
+        return;
+    }
+    _dir_refs.erase(wd);
+#ifdef __linux
+    inotify_rm_watch(_inotify_fd, wd);
+#endif
+    for(auto &[dir, dir_wd] : _dir_watches) {
+        if (dir_wd == wd) {
+            _dir_watches.erase(dir);
+            break;
+        }
+    }
+    _watched_names.erase(wd);
+    _generations.erase(wd);
+}
+
+void StatCache_t::invalidate(int wd, const std::string &name)
+{
+    _generations[wd] += 1;
+    if (_watched_names.contains(wd) && _watched_names[wd].contains(name)) {
+        std::stringlist keys = _watched_names[wd][name];
+        _watched_names[wd].erase(name);
+        for(const std::string &key : keys) {
+            _invalidations += drop(key);
+        }
+    }
+}
+
+void StatCache_t::invalidateDir(int wd)
+{
+    _generations[wd] += 1;
+    if (_watched_names.contains(wd)) {
+        wwhash<std::string, std::stringlist> names;
+        names.swap(_watched_names[wd]);
+        for(auto &[name, keys] : names) {
+            for(const std::string &key : keys) {
+                _invalidations += drop(key);
+            }
+        }
+    }
+}
+
+void StatCache_t::watcher()
+{
+#ifdef __linux
+    alignas(struct inotify_event) char buf[16384];
+
+    while (!_stop) {
+        struct pollfd pfd = { _inotify_fd, POLLIN, 0 };
+        if (poll(&pfd, 1, 250) <= 0) {
+            continue;       // Timeout, look at _stop again
+        }
+        ssize_t n = read(_inotify_fd, buf, sizeof(buf));
+        if (n <= 0) {
+            continue;
+        }
+
+        _mutex.lock();
+        for(char *p = buf; p < buf + n; ) {
+            struct inotify_event *ev = reinterpret_cast<struct inotify_event *>(p);
+            if (ev->mask & IN_Q_OVERFLOW) {
+                _invalidations += _entries.size();
+                for(auto &[path, e] : _entries) { release(e.wd); }
+                _entries.clear();
+                _lru.clear();
+                for(auto &[wd, gen] : _generations) { gen += 1; }
+                for(auto &[wd, names] : _watched_names) { names.clear(); }
+            } else if (ev->mask & (IN_DELETE_SELF | IN_MOVE_SELF | IN_IGNORED)) {
+                invalidateDir(ev->wd);
+                if (ev->mask & IN_IGNORED) {        // The kernel dropped the watch
+                    for(auto &[dir, wd] : _dir_watches) {
+                        if (wd == ev->wd) {
+                            _dir_watches.erase(dir);
+                            break;
+                        }
+                    }
+                    _watched_names.erase(ev->wd);
+                    if (!_dir_refs.contains(ev->wd)) {
+                        _generations.erase(ev->wd);     // Also the answer to our own inotify_rm_watch
+                    }
+                }
+            } else {
+                invalidate(ev->wd, (ev->len > 0) ? std::string(ev->name) : std::string());
+            }
+            p += sizeof(struct inotify_event) + ev->len;
+        }
+        _mutex.unlock();
+    }
+#endif
+}
+
+bool StatCache_t::plausiblePath(const std::string &text)
+{
+    // Html is not worth a cache entry and a watch: a path has no markup or control
+    // characters. Anything else may be a file, also without an extension (README)
+    if (text.empty() || text.size() > STAT_CACHE_MAX_PATH) {
+        return false;
+    }
+    for(unsigned char c : text) {
+        if (c < 0x20 || c == '<' || c == '>' || c == '"' || c == '|' || c == '*' || c == '?') {
+            return false;
+        }
+    }
+    return true;
+}
+
+void StatCache_t::stat(const std::string &path, FileStat_t &st)
+{
+    if (!plausiblePath(path)) {
+        statPath(path, st);
+        return;
+    }
+
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    _mutex.lock();
+    if (_entries.contains(path)) {
+        Entry_t &e = _entries[path];
+        if (e.watched || now - e.at < std::chrono::milliseconds(STAT_CACHE_TTL_MS)) {
+            st = e.st;
+            _lru.splice(_lru.begin(), _lru, e.lru_it);
+            _hits += 1;
+            _mutex.unlock();
+            return;
+        }
+        drop(path);
+    }
+    _misses += 1;
+
+    // Watch before stat'ing, so a change in between is seen as a new generation
+    std::string name;
+    int wd = watch(path, name);
+    unsigned long long gen = (wd >= 0) ? _generations[wd] : 0;
+    _mutex.unlock();
+
+    statPath(path, st);
+
+    _mutex.lock();
+    auto it = _entries.find(path);
+    if (it != _entries.end()) {     // Another thread stat'ed it meanwhile, its watch registration is ours too
+        int other_wd = it->second.wd;
+        _lru.erase(it->second.lru_it);
+        _entries.erase(it);
+        release(other_wd);
+    }
+    while (_entries.size() >= STAT_CACHE_MAX_ENTRIES) {
+        std::string oldest = _lru.back();     // drop() erases the list element
+        drop(oldest);
+    }
+    _lru.push_front(path);
+    Entry_t e = { st, wd >= 0 && _generations[wd] == gen, now, _lru.begin(), wd, name };
+    _entries[path] = e;
+    _mutex.unlock();
+}
+
+void StatCache_t::clear()
+{
+    _mutex.lock();
+    for(auto &[path, e] : _entries) { release(e.wd); }
+    _entries.clear();
+    _lru.clear();
+    for(auto &[wd, names] : _watched_names) { names.clear(); }
+    _mutex.unlock();
+}
+
+JSON StatCache_t::stats()
+{
+    JSON j;
+    _mutex.lock();
+    j["hits"] = _hits;
+    j["misses"] = _misses;
+    j["invalidations"] = _invalidations;
+    j["entries"] = _entries.size();
+    j["watched-dirs"] = _dir_watches.size();
+    j["inotify"] = _inotify_fd >= 0;
+    j["syscalls-avoided"] = _hits * STAT_CACHE_MISS_SYSCALLS;
+    _mutex.unlock();
+    return j;
+}
+
+StatCache_t &StatCache_t::shared()
+{
+    static StatCache_t cache;
+    return cache;
+}
+
+StatCache_t::StatCache_t()
+{
+    _hits = 0;
+    _misses = 0;
+    _invalidations = 0;
+    _stop = false;
+    _watcher = nullptr;
+    _inotify_fd = -1;
+#ifdef __linux
+    _inotify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (_inotify_fd >= 0) {
+        _watcher = new std::thread([this]() { watcher(); });
+        setThreadName(_watcher, "stat-cache-watcher");
+    }
+#endif
+}
+
+StatCache_t::~StatCache_t()
+{
+    _stop = true;
+    if (_watcher != nullptr) {
+        _watcher->join();
+        delete _watcher;
+    }
+#ifdef __linux
+    if (_inotify_fd >= 0) {
+        close(_inotify_fd);
+    }
+#endif
+}
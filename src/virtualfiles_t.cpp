@@ -0,0 +1,107 @@
+#include "virtualfiles_t.h"
+#include "httpresponse_t.h"
+
+void VirtualFiles_t::expire()
+{
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    for(auto it = _files.begin(); it != _files.end(); ) {
+        if (it->second->expires && it->second->expires_at <= now) {
+            _bytes -= it->second->data.size();
+            it = _files.erase(it);
+        } else {
+            it++;
+        }
+    }
+}
+
+void VirtualFiles_t::put(const std::string &path, const std::string &content_type, const std::string &data, int ttl_seconds)
+{
+    std::shared_ptr<VirtualFile_t> f = std::make_shared<VirtualFile_t>();
+    f->path = normalizedPath(path);
+    f->content_type = content_type;
+    f->data = data;
+    f->etag = HttpResponse_t::etag(data);
+    f->modified = std::time(nullptr);
+    f->expires = ttl_seconds > 0;
+    f->expires_at = std::chrono::steady_clock::now() + std::chrono::seconds(ttl_seconds);
+
+    _mutex.lock();
+    expire();
+    if (_files.contains(f->path)) {
+        _bytes -= _files[f->path]->data.size();
+    }
+    _files[f->path] = f;        // Requests in progress keep the replaced content
+    _bytes += data.size();
+    _mutex.unlock();
+}
+
+bool VirtualFiles_t::remove(const std::string &path)
+{
+    std::string p = normalizedPath(path);
+    bool found = false;
+
+    _mutex.lock();
+    if (_files.contains(p)) {
+        _bytes -= _files[p]->data.size();
+        _files.erase(p);
+        found = true;
+    }
+    _mutex.unlock();
+
+    return found;
+}
+
+VirtualFilePtr VirtualFiles_t::get(const std::string &path)
+{
+    VirtualFilePtr f;
+
+    _mutex.lock();
+    if (!_files.empty()) {
+        auto it = _files.find(normalizedPath(path));
+        if (it != _files.end()) {
+            if (it->second->expires && it->second->expires_at <= std::chrono::steady_clock::now()) {
+                _bytes -= it->second->data.size();
+                _files.erase(it);
+            } else {
+                f = it->second;
+                _hits += 1;
+            }
+        }
+    }
+    _mutex.unlock();
+
+    return f;
+}
+
+JSON VirtualFiles_t::stats()
+{
+    JSON j;
+    _mutex.lock();
+    expire();
+    j["files"] = _files.size();
+    j["bytes"] = _bytes;
+    j["hits"] = _hits;
+    _mutex.unlock();
+    return j;
+}
+
+std::string VirtualFiles_t::normalizedPath(const std::string &path)
+{
+    std::string p = replace(trim_copy(path), "\\", "/");
+    if (p.rfind("/", 0) != 0) {
+        p = "/" + p;
+    }
+    return p;
+}
+
+VirtualFiles_t &VirtualFiles_t::shared()
+{
+    static VirtualFiles_t files;
+    return files;
+}
+
+VirtualFiles_t::VirtualFiles_t()
+{
+    _bytes = 0;
+    _hits = 0;
+}
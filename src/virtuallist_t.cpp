@@ -0,0 +1,121 @@
+#include "virtuallist_t.h"
+
+#include <algorithm>
+#include <vector>
+#include <cstdlib>
+
+void VirtualList_t::evict()
+{
+    if (static_cast<int>(_cached.size()) <= _cache_rows) {
+        return;
+    }
+
+    wwlist<int> rows = _cached.keys();
+    std::vector<int> by_distance(rows.begin(), rows.end());
+    int center = _center;
+    std::sort(by_distance.begin(), by_distance.end(), [center](int a, int b) {
+        return std::abs(a - center) > std::abs(b - center);
+    });
+
+    size_t drop = _cached.size() - (_cache_rows - _cache_rows / 10);    // Some room, not to do this on every put
+    for(size_t i = 0; i < drop && i < by_distance.size(); i++) {
+        _cached.erase(by_distance[i]);
+    }
+}
+
+void VirtualList_t::addToRuns(JSON &runs, int row, const JSON &data, int &run_from)
+{
+    if (runs.length() == 0 || row != run_from + runs.at(runs.length() - 1).at(1).length()) {
+        runs.append(Array(row, JSON::Make(JSON::Class::Array)));
+        run_from = row;
+    }
+    runs.at(runs.length() - 1).at(1).append(data);
+}
+
+JSON VirtualList_t::request(int from, int count, JSON &host_runs)
+{
+    JSON runs = JSON::Make(JSON::Class::Array);
+    int run_from = -1;
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    _mutex.lock();
+    _center = from + count / 2;
+    if (_wanted.size() > VIRTUAL_LIST_MAX_WANTED) {
+        _wanted.clear();
+    }
+
+    for(int i = std::max(from, 0); i < from + count && i < _rows; i++) {
+        if (_cached.contains(i)) {
+            addToRuns(runs, i, _cached[i], run_from);
+        } else {
+            _wanted[i] = true;
+        }
+    }
+
+    // Only the missing rows are asked, one run at a time, not what lies between them
+    host_runs = JSON::Make(JSON::Class::Array);
+    int miss_from = -1;
+    int miss_to = -1;
+    for(int i = std::max(from - _prefetch, 0); i < from + count + _prefetch && i < _rows; i++) {
+        if (_cached.contains(i)) { continue; }
+        if (_pending.contains(i) && now - _pending[i] < std::chrono::milliseconds(VIRTUAL_LIST_PENDING_MS)) { continue; }
+        _pending[i] = now;
+        if (miss_from >= 0 && i != miss_to + 1) {
+            host_runs.append(Array(miss_from, miss_to - miss_from + 1));
+            miss_from = -1;
+        }
+        if (miss_from < 0) { miss_from = i; }
+        miss_to = i;
+    }
+    if (miss_from >= 0) {
+        host_runs.append(Array(miss_from, miss_to - miss_from + 1));
+    }
+    _mutex.unlock();
+
+    return runs;
+}
+
+JSON VirtualList_t::put(int from, const JSON &rows)
+{
+    JSON runs = JSON::Make(JSON::Class::Array);
+    int run_from = -1;
+
+    _mutex.lock();
+    for(int k = 0; k < rows.length() && from + k < _rows; k++) {
+        int i = from + k;
+        _cached[i] = rows.at(k);
+        _pending.erase(i);
+        if (_wanted.contains(i)) {
+            _wanted.erase(i);
+            addToRuns(runs, i, rows.at(k), run_from);
+        }
+    }
+    evict();
+    _mutex.unlock();
+
+    return runs;
+}
+
+void VirtualList_t::setRowCount(int rows, bool reset)
+{
+    _mutex.lock();
+    _rows = rows;
+    if (reset) {
+        _cached.clear();
+        _pending.clear();
+        _wanted.clear();
+    } else {
+        for(int i : _cached.keys()) {
+            if (i >= rows) { _cached.erase(i); }
+        }
+    }
+    _mutex.unlock();
+}
+
+VirtualList_t::VirtualList_t(int rows, int cache_rows, int prefetch)
+{
+    _rows = rows;
+    _cache_rows = cache_rows;
+    _prefetch = prefetch;
+    _center = 0;
+}
@@ -6,8 +6,10 @@
 #include "execjs.h"
 #include "webwireprofile.h"
 #include "httpresponse_t.h"
+#include "filecache_t.h"
 #include "mimetypes_t.h"
 #include "webui_utils.h"
+#include "statcache_t.h"
 #include <regex>
 #include <string.h>
 #include "json.h"
@@ -55,6 +57,76 @@ static void web_ui_wire_handle_move(webui_event_t *e)
     if (win != nullptr) win->handleMoveEvent(e);
 }
 
+#ifdef __linux
+static gboolean web_ui_wire_flush_geometry(gpointer data)
+{
+    size_t webui_win = reinterpret_cast<size_t>(data);
+    if (_windows.contains(webui_win)) {
+        WebUIWindow *win = _windows[webui_win];
+        win->clearGeometryFlushSource();
+        win->flushNativeGeometry();
+    }
+    return G_SOURCE_REMOVE;
+}
+
+static gboolean web_ui_wire_configure_event(GtkWidget *widget, GdkEventConfigure *e, gpointer data)
+{
+    size_t webui_win = reinterpret_cast<size_t>(data);
+    if (_windows.contains(webui_win)) {
+        GtkWindow *gtk_win = reinterpret_cast<GtkWindow *>(widget);
+        int x, y, w, h;
+        gtk_window_get_position(gtk_win, &x, &y);
+        gtk_window_get_size(gtk_win, &w, &h);
+        _windows[webui_win]->nativeGeometryChanged(x, y, w, h);
+    }
+    return FALSE;   // Let gtk continue handling the configure event
+}
+#endif
+
+#ifdef _WINDOWS
+#include <commctrl.h>
+
+#define WEB_WIRE_GEOMETRY_SUBCLASS_ID   0x5757
+#define WEB_WIRE_GEOMETRY_TIMER_ID      0x5758
+
+static LRESULT CALLBACK web_ui_wire_geometry_proc(HWND hwnd, UINT msg, WPARAM wparam, LPARAM lparam,
+                                                  UINT_PTR subclass_id, DWORD_PTR ref_data)
+{
+    size_t webui_win = static_cast<size_t>(ref_data);
+    if (msg == WM_MOVE || msg == WM_SIZE) {
+        if (_windows.contains(webui_win)) {
+            RECT r;
+            GetWindowRect(hwnd, &r);
+            _windows[webui_win]->nativeGeometryChanged(r.left, r.top, r.right - r.left, r.bottom - r.top);
+            // (Re)arm the timer, so we report once the window comes to rest
+            SetTimer(hwnd, WEB_WIRE_GEOMETRY_TIMER_ID, NATIVE_GEOMETRY_COALESCE_MS, NULL);
+        }
+    } else if (msg == WM_TIMER && wparam == WEB_WIRE_GEOMETRY_TIMER_ID) {
+        KillTimer(hwnd, WEB_WIRE_GEOMETRY_TIMER_ID);
+        if (_windows.contains(webui_win)) {
+            _windows[webui_win]->flushNativeGeometry();
+        }
+        return 0;
+    } else if (msg == WM_NCDESTROY) {
+        KillTimer(hwnd, WEB_WIRE_GEOMETRY_TIMER_ID);
+        RemoveWindowSubclass(hwnd, web_ui_wire_geometry_proc, subclass_id);
+    }
+    return DefSubclassProc(hwnd, msg, wparam, lparam);
+}
+#endif
+
+#ifdef __APPLE__
+static void web_ui_wire_apple_geometry(size_t webui_win, int x, int y, int w, int h)
+{
+    // Cocoa only notifies when a move or live resize has ended, no need to coalesce further
+    if (_windows.contains(webui_win)) {
+        WebUIWindow *win = _windows[webui_win];
+        win->nativeGeometryChanged(x, y, w, h);
+        win->flushNativeGeometry();
+    }
+}
+#endif
+
 static bool web_ui_wire_on_close(size_t window)
 {
     WebUIWindow *win = get_webui_window(window);
@@ -130,6 +202,101 @@ static bool isHTML(const char *_buf, int max_search)
     return false;
 }
 
+// Position right after the first <head> tag (any case, attributes allowed), npos if there is none
+static size_t headInsertPosition(const char *d, size_t n)
+{
+    size_t from = 0;
+    while (from < n) {
+        size_t at = find_nocase(d + from, n - from, "<head", 5);
+        if (at == std::string::npos) {
+            return std::string::npos;
+        }
+        at += from + 5;
+        if (at < n && (d[at] == '>' || is_space(d[at]))) {
+            const char *gt = static_cast<const char *>(memchr(d + at, '>', n - at));
+            return (gt == nullptr) ? std::string::npos : (gt - d) + 1;
+        }
+        from = at;          // e.g. <header>
+    }
+    return std::string::npos;
+}
+
+static bool isHTMLFile(FileInfo_t &fi)
+{
+    if (fi.ext() == "html" || fi.ext() == "htm") {
+        return true;
+    }
+
+    std::string file = fi.toString();
+#ifdef _WINDOWS
+    FILE *f;
+    fopen_s(&f, file.c_str(), "rb");
+#else
+    FILE *f = fopen(file.c_str(), "rb");
+#endif
+    if (f == nullptr) {
+        return false;
+    }
+    char buffer[1024 + 1];
+    size_t n = fread(buffer, 1, 1024, f);
+    fclose(f);
+    buffer[n] = '\0';
+    return isHTML(buffer, n);
+}
+
+static bool readFile(const std::string &file, size_t file_size, std::string &content)
+{
+#ifdef _WINDOWS
+    FILE *f;
+    fopen_s(&f, file.c_str(), "rb");
+#else
+    FILE *f = fopen(file.c_str(), "rb");
+#endif
+    if (f == nullptr) {
+        return false;
+    }
+
+    content.resize(file_size);
+    size_t n = fread(content.data(), 1, file_size, f);
+    fclose(f);
+    content.resize(n);
+    return true;
+}
+
+FileCacheEntryPtr WebUIWindow::loadFile(FileInfo_t &fi, std::filesystem::file_time_type mtime, size_t file_size,
+                                        const std::string &cache_control)
+{
+    std::string file = fi.toString();
+    std::string content;
+    if (!readFile(file, file_size, content)) {
+        _handler->error("Cannot open file " + file);
+        return nullptr;
+    }
+    size_t n = content.size();
+
+    std::shared_ptr<FileCacheEntry_t> e = std::make_shared<FileCacheEntry_t>();
+    e->file = file;
+    e->mtime = mtime;
+    e->size = file_size;
+    e->etag = HttpResponse_t::etag(mtime, file_size);
+    e->last_modified = FileInfo_t::toTime(mtime);
+
+    int max_search = (n > 1024) ? 1024 : n;
+    e->is_html = fi.ext() == "html" || fi.ext() == "htm" || isHTML(content.c_str(), max_search);
+    if (e->is_html) {
+        e->content_type = "text/html";
+        e->data = content;
+    } else {
+        HttpResponse_t resp(_handler, 200);
+        e->content_type = resp.contentTypeForFileExt(fi.ext());
+        resp.setContentType(e->content_type);
+        resp.setValidators(e->etag, e->last_modified);
+        resp.setCachePolicy(cache_control);
+        e->data = resp.header(content.size()) + content;
+    }
+
+    return e;
+}
 
 int WebUIWindow::newHandle()
 {
@@ -167,10 +334,11 @@ std::string WebUIWindow::rootFolder()
 void WebUIWindow::setWindowIcon(const std::string &icn_file)
 {
     FileInfo_t fi(icn_file);
-    if (fi.exists() && fi.isReadable() && fi.ext() == "svg") {
-        MimeTypes_t m(_handler);
-        std::string type = m.mimetypeByExt(fi.ext());
-        int size = fi.size();
+    FileStat_t st;
+    StatCache_t::shared().stat(icn_file, st);
+    if (st.exists && st.readable && fi.ext() == "svg") {
+        std::string type(MimeTypes_t::mimetypeByExt(fi.ext()));
+        int size = st.size;
         FILE *f;
 #ifdef _WINDOWS
         fopen_s(&f, icn_file.c_str(), "rb");
@@ -201,6 +369,27 @@ void WebUIWindow::setWindowTitle(const std::string &title)
     _handler->execJs(_win, code, "set-title");
 }
 
+void WebUIWindow::setNativeTitle(const std::string &title)
+{
+    if (_use_browser || _win_handle == NULL) {
+        return;
+    }
+#ifdef _WINDOWS
+    int n = MultiByteToWideChar(CP_UTF8, 0, title.c_str(), -1, NULL, 0);
+    if (n > 0) {
+        std::wstring w_title(n, L'\0');
+        MultiByteToWideChar(CP_UTF8, 0, title.c_str(), -1, w_title.data(), n);
+        SetWindowTextW(_win_handle, w_title.c_str());
+    }
+#endif
+#ifdef __linux
+    gtk_window_set_title(_win_handle, title.c_str());
+#endif
+#ifdef __APPLE__
+    set_window_title_apple(_win_handle, title.c_str());
+#endif
+}
+
 void WebUIWindow::setClosing(bool y)
 {
     _closing = y;
@@ -232,7 +421,9 @@ void WebUIWindow::close()
 
 bool WebUIWindow::canClose()
 {
-    _handler->evt(asprintf("close-request:%d", _win));
+    if (!_detached) {
+        _handler->evt(asprintf("close-request:%d", _win));
+    }
     if (_closing) { return true; }
     return false;
 }
@@ -258,25 +449,12 @@ void WebUIWindow::resize(int w, int h)
 
 std::string WebUIWindow::standardMessage()
 {
-    WinInfo_t *i = _handler->getWinInfo(_win);
-
-    std::string profile_scripts;
-    if (i != nullptr) {
-        profile_scripts = i->profile->scriptsTag();
-    }
-
-    std::string webui_js = asprintf("/webui.js");
     std::string window = asprintf("%d", _win);
 
-
     std::string standard_msg = "<!DOCTYPE html>\n"
                                "<html>\n"
-                               "<head>\n"
-                               "<script>\n"
-                               "window._page_handle = " + asprintf("%d", _current_handle) + ";\n"
-                               "</script>\n"
-                               "<script src=\"" + webui_js + "\"></script>\n" +
-                               profile_scripts +
+                               "<head>\n" +
+                               headScripts() +
                                "<title>Web UI Wire: " WEB_WIRE_VERSION "</title>\n"
                                "</head>\n"
                                "<body><p>Web UI Wire:" WEB_WIRE_VERSION "</p>\n"
@@ -288,6 +466,183 @@ std::string WebUIWindow::standardMessage()
     return standard_msg;
 }
 
+std::string WebUIWindow::headScripts()
+{
+    WinInfo_t *i = _handler->getWinInfo(_win);
+
+    std::string profile_scripts;
+    if (i != nullptr) {
+        profile_scripts = i->profile->scriptsTag();
+    }
+
+    // In a webview, moves and resizes are reported by the native window,
+    // in a browser the page needs to report them itself.
+    std::string native_geometry = (_use_browser) ? "false" : "true";
+
+    // The title given to 'new' wins over the one of the first page
+    std::string title;
+    if (_initial_title != "" && _current_handle == _initial_handle) {
+        title = "window.addEventListener('DOMContentLoaded', function() { document.title = '" +
+                ExecJs::esc_quote(_initial_title) + "'; });\n";
+    }
+
+    // The css given to 'new' replaces the profile's stylesheet on the first page only
+    std::string css;
+    if (_initial_css != "" && _current_handle == _initial_handle) {
+        css = "<script>\n"
+              "{ let el = document.getElementById('web-wire-css'); "
+              "if (el !== null) { el.textContent = '" + ExecJs::esc_quote(_initial_css) + "'; } }\n"
+              "</script>\n";
+    }
+
+    return "<script>\n"
+           "window._page_handle = " + asprintf("%d", _current_handle) + ";\n"
+           "window._web_wire_native_geometry = " + native_geometry + ";\n" +
+           title +
+           "</script>\n"
+           "<script src=\"/webui.js\"></script>\n" +
+           profile_scripts +
+           css;
+}
+
+std::string WebUIWindow::fileUrl(const std::string &file, bool &ok)
+{
+    WebUI_Utils utils;
+    std::string url = baseUrl() + utils.encodeUrl(replace(file, "\\", "/"));
+    ok = utils.checkUrl(url);
+    return (ok) ? utils.normalizeUrl(url) : url;
+}
+
+const void *WebUIWindow::assetHandler(const std::string &url_path, int *length)
+{
+    WinInfo_t *i = _handler->getWinInfo(_win);
+    if (i != nullptr && url_path.rfind(std::string(WEB_WIRE_ASSET_PREFIX) + "profile-", 0) == 0) {
+        std::string url;
+        std::string js = i->profile->scriptsAsset(url);
+
+        HttpResponse_t resp(_handler, 200);
+        resp.setContentType("application/javascript");
+        if (url == url_path) {
+            // The url is versioned by the content hash, so it never changes.
+            resp.addHeader("Cache-Control", "public, max-age=31536000, immutable");
+        } else {
+            // A page that still refers to a previous version (e.g. after set-stylesheet)
+            resp.addHeader("Cache-Control", "no-cache");
+        }
+        resp.setValidators(HttpResponse_t::etag(js), 0);
+        resp.setContent(js);
+        return resp.response(*length);
+    }
+
+    HttpResponse_t resp(_handler, 404);
+    resp.setContentType("text/plain");
+    resp.setContent("Not found: " + url_path);
+    return resp.response(*length);
+}
+
+const void *WebUIWindow::virtualHandler(VirtualFilePtr vf, int *length)
+{
+    HttpResponse_t resp(_handler, 200);
+    resp.setContentType(vf->content_type);
+    resp.addHeader("Cache-Control", "no-cache");       // put-file can replace it at any time
+
+    const char *body = vf->data.data();
+    size_t size = vf->data.size();
+    if (vf->content_type.rfind("text/html", 0) == 0) {
+        size_t at = headInsertPosition(body, size);
+        if (at != std::string::npos) {
+            return resp.injectedResponse(body, size, at, "\n" + headScripts(), *length);
+        }
+    } else {
+        resp.setValidators(vf->etag, vf->modified);
+    }
+    return resp.injectedResponse(body, size, 0, "", *length);
+}
+
+const void *WebUIWindow::dynamicHandler(const std::string &route, int timeout_ms, const std::string &url_path,
+                                        int *length)
+{
+    DynamicResponsePtr r = DynamicRoutes_t::shared().request(url_path, timeout_ms, [this, &route, &url_path](int id) {
+        JSON j;
+        j["id"] = id;
+        j["route"] = route;
+        j["path"] = url_path;
+        _handler->evt(asprintf("request:%d:", _win) + j.dump());
+    });
+
+    if (!r) {
+        HttpResponse_t resp(_handler, 504);
+        resp.setContentType("text/plain");
+        resp.setContent("No response from host for: " + url_path);
+        return resp.response(*length);
+    }
+
+    HttpResponse_t resp(_handler, r->code);
+    resp.setContentType(r->content_type);
+    resp.addHeader("Cache-Control", (r->cache_control == "") ? "no-cache" : r->cache_control);
+
+    const char *body = r->data.data();
+    size_t size = r->data.size();
+    if (r->content_type.rfind("text/html", 0) == 0) {
+        size_t at = headInsertPosition(body, size);
+        if (at != std::string::npos) {
+            return resp.injectedResponse(body, size, at, "\n" + headScripts(), *length);
+        }
+    } else if (r->code == 200) {
+        resp.setValidators(r->etag, r->modified);
+    }
+    return resp.injectedResponse(body, size, 0, "", *length);
+}
+
+const void *WebUIWindow::bundleHandler(AssetBundlePtr bundle, const std::string &entry_path, const std::string &url_path,
+                                       int *length)
+{
+    if (entry_path == "") {
+        // /app for a bundle mounted at /app/, relative urls in its pages need the slash
+        HttpResponse_t resp(_handler, 301);
+        resp.addHeader("Location", url_path + "/");
+        resp.setContentType("text/plain");
+        resp.setContent("Moved to: " + url_path + "/");
+        return resp.response(*length);
+    }
+
+    const AssetBundleEntry_t *e = bundle->entry(entry_path);
+    if (e == nullptr) {
+        HttpResponse_t resp(_handler, 404);
+        resp.setContentType("text/plain");
+        resp.setContent("Not found: " + url_path);
+        return resp.response(*length);
+    }
+
+    HttpResponse_t resp(_handler, 200);
+    resp.setContentType(e->content_type);
+
+    // Html is read to inject the scripts, anything else is read by response() straight into webui's buffer
+    std::string body;
+    bool ok = (e->is_html) ? bundle->read(e->offset, e->size, body) : bundle->unchanged();
+    if (!ok) {
+        _handler->error("Bundle for " + url_path + " has changed on disk, mount it again");
+        HttpResponse_t err(_handler, 503);
+        err.setContentType("text/plain");
+        err.setContent("Bundle changed on disk: " + url_path);
+        return err.response(*length);
+    }
+
+    if (e->is_html) {
+        resp.addHeader("Cache-Control", "no-cache");   // Holds a per window handle
+        size_t at = headInsertPosition(body.data(), body.size());
+        if (at == std::string::npos) {
+            return resp.injectedResponse(body.data(), body.size(), 0, "", *length);
+        }
+        return resp.injectedResponse(body.data(), body.size(), at, "\n" + headScripts(), *length);
+    }
+
+    resp.setCachePolicy(HttpResponse_t::cacheControl(url_path));
+    resp.setValidators(e->etag, bundle->lastModified());
+    resp.setFilePart(bundle->file(), e->offset, e->size);
+    return resp.response(*length);
+}
+
 const void *WebUIWindow::filesHandler(const char *url_path, int *length)
 {
     _served++;
@@ -298,19 +653,31 @@ const void *WebUIWindow::filesHandler(const char *url_path, int *length)
     std::string file_path = url_path;
     std::regex_search(file_path, m, re);
 
-    WinInfo_t *i = _handler->getWinInfo(_win);
-    std::string profile_scripts;
-    if (i != nullptr) {
-        profile_scripts = i->profile->scriptsTag();
-    }
-
     Timer_t *t = _handler->getTimer(_win);
     if (t != nullptr) {
         t->reset();
     }
 
-    std::string webui_js = "/webui.js";
-    std::string window = asprintf("%d", _win);
+    if (file_path.rfind(WEB_WIRE_ASSET_PREFIX, 0) == 0) {
+        return assetHandler(file_path, length);
+    }
+
+    VirtualFilePtr vf = VirtualFiles_t::shared().get(file_path);
+    if (vf) {
+        return virtualHandler(vf, length);
+    }
+
+    std::string route;
+    int timeout_ms;
+    if (DynamicRoutes_t::shared().route(file_path, route, timeout_ms)) {
+        return dynamicHandler(route, timeout_ms, file_path, length);
+    }
+
+    std::string entry_path;
+    AssetBundlePtr bundle = AssetBundle_t::find(file_path, entry_path);
+    if (bundle) {
+        return bundleHandler(bundle, entry_path, file_path, length);
+    }
 
     bool root_url = false;
     bool empty_url = false;
@@ -339,53 +706,55 @@ const void *WebUIWindow::filesHandler(const char *url_path, int *length)
         resp.setContent(standard_msg);
         return resp.response(*length);
     } else {
-        FileInfo_t fi(file);
-        if (!fi.exists()) {
+        StatCache_t &stat_cache = StatCache_t::shared();
+        FileStat_t st;
+        stat_cache.stat(file, st);
+        if (!st.exists) {
             std::string d = std::filesystem::current_path().string();
             file = d + file;
-            fi = FileInfo_t(file);
+            stat_cache.stat(file, st);
         }
+        FileInfo_t fi(file);
         HttpResponse_t resp(_handler);
-        if (fi.exists() && fi.isReadable()) {
-            size_t file_size = fi.size();
-            int max_search = (file_size > 1024) ? 1024 : file_size;
-#ifdef _WINDOWS
-            FILE *f;
-            fopen_s(&f, file.c_str(), "rb");
-#else
-            FILE *f = fopen(file.c_str(), "rb");
-#endif
-            char *buffer = static_cast<char *>(malloc(max_search + 1));
-            memset(buffer, 0, max_search + 1);
-            fread(buffer, max_search, 1, f);
-            buffer[max_search] = '\0';
-            std::string content_type;
-            if (fi.ext() == "html" || fi.ext() == "htm" || isHTML(buffer, max_search)) {
-                buffer = static_cast<char *>(realloc(buffer, file_size + 1));
-                fread(buffer + max_search, file_size - max_search, 1, f);
-                fclose(f);
-                buffer[file_size] = '\0';
-
-                std::string body(buffer);
-                free(buffer);
-                body = replace(body, "<head>", "<head>\n"
-                                               "<script>\n"
-                                               "window._page_handle = " + asprintf("%d", _current_handle) + ";\n"
-                                               "</script>\n"
-                                               "<script src=\"" + webui_js + "\"></script>\n"
-                                               + profile_scripts
-                               );
-                content_type = "text/html";
-
-                resp.setContentType(content_type);
-                resp.setResponseCode(200);
-                resp.setContent(body);
-            } else {
-                fclose(f);
-                free(buffer);
-                resp.setFile(file);
+        std::string cache_control = HttpResponse_t::cacheControl(file_path);
+        if (st.exists && st.readable) {
+            size_t file_size = st.size;
+            std::filesystem::file_time_type mtime = st.mtime;
+            FileCache_t &cache = FileCache_t::shared();
+            bool cacheable = cache.cacheable(file_size);
+
+            FileCacheEntryPtr e;
+            if (cacheable) {
+                e = cache.lookup(file, mtime, file_size);
+            }
+            if (!e) {
+                if (cacheable || isHTMLFile(fi)) {
+                    e = loadFile(fi, mtime, file_size, cache_control);
+                    if (e && cacheable) {
+                        cache.insert(e);
+                    }
+                } else {
+                    // Too big to cache and no html to inject, serve it straight from disk
+                    resp.setFile(file);
+                    resp.setCachePolicy(cache_control);
+                    return resp.response(*length);
+                }
+            }
+
+            if (e) {
+                if (e->is_html) {
+                    size_t at = headInsertPosition(e->data.data(), e->data.size());
+                    resp.setContentType(e->content_type);
+                    resp.setResponseCode(200);
+                    resp.addHeader("Cache-Control", "no-cache");   // Holds a per window handle
+                    if (at == std::string::npos) {
+                        return resp.injectedResponse(e->data.data(), e->data.size(), 0, "", *length);
+                    }
+                    return resp.injectedResponse(e->data.data(), e->data.size(), at, "\n" + headScripts(), *length);
+                } else {
+                    return HttpResponse_t::response(e->data, *length);
+                }
             }
-            return resp.response(*length);
         } else if (file.rfind("favicon.", 0) == 0) {
             return nullptr;
         } else {
@@ -393,12 +762,8 @@ const void *WebUIWindow::filesHandler(const char *url_path, int *length)
             resp.setContentType("text/html");
             resp.setContent("<!DOCTYPE html>\n"
                            "<html>\n"
-                           "<head>\n"
-                           "<script>\n"
-                            "window._page_handle = " + asprintf("%d", _current_handle) + ";\n"
-                           "</script>\n"
-                           "<script src=\"" + webui_js + "\"></script>\n" +
-                           profile_scripts +
+                           "<head>\n" +
+                           headScripts() +
                            "</head>"
                            "<body><p>Web UI Wire:" WEB_WIRE_VERSION "</p>"
                            "<p>Not found: " + file + "</p>"
@@ -426,7 +791,9 @@ typedef struct webui_event_t {
 void WebUIWindow::webuiEvent(webui_event_t *e)
 {
     if (e->event_type == WEBUI_EVENT_CONNECTED) {
+        _ready_mutex.lock();
         _disconnected = false;
+        _ready_mutex.unlock();
         Timer_t *t = _handler->getTimer(_win);
         if (t != nullptr) {
             t->stop();
@@ -435,7 +802,13 @@ void WebUIWindow::webuiEvent(webui_event_t *e)
         return;
     } else if (e->event_type == WEBUI_EVENT_DISCONNECTED) {
         _handler->message(asprintf("Window %d (%d) disconnected - clientid = %d", _win, _webui_win, e->client_id));
+        _ready_mutex.lock();
         _disconnected = true;
+        _disconnected_at = std::chrono::steady_clock::now();
+        if (e->connection_id == _ready_connection) {
+            _page_loaded = false;       // Scripts wait for the next page-loaded
+        }
+        _ready_mutex.unlock();
         if (!_closing && !_in_set_html_or_url) {
             Timer_t *t = _handler->getTimer(_win);
             if (t != nullptr) {
@@ -470,7 +843,9 @@ void WebUIWindow::webuiEvent(webui_event_t *e)
         j["navigation-kind"] = kind;
         std::string evt = asprintf("navigate:%d:%s", _win, j.dump().c_str());
         _handler->message(evt);
-        _handler->evt(evt);
+        if (!_detached) {
+            _handler->evt(evt);
+        }
         return;
     }
     _handler->message(asprintf("webui-event: %s: %d %d", e->element, e->event_type, e->event_number));
@@ -519,9 +894,64 @@ void WebUIWindow::handleWireEvent(webui_event_t *e)
             } else {
                 _handler->error(asprintf("handleWireEvent: Unexpected script-result: %s", event.c_str()));
             }
+        } else if (evt == "inner-html-set" && j.hasKey("resync")) {
+            // A patch did not fit the page's elements, send the html it was made for
+            std::string id = j["resync"].toRawString();
+            int handle = static_cast<int>(j["handle"].toInt());
+            _html_mutex.lock();
+            bool have = _html_sources.contains(id);
+            std::string html = have ? _html_sources[id] : "";
+            _html_mutex.unlock();
+            WinInfo_t *i = _handler->getWinInfo(_win);
+            if (have && i != nullptr) {
+                _handler->message(asprintf("Window %d: resending the html of '%s'", _win, id.c_str()));
+                i->profile->set_html(_handler, _win, handle, id, html, false);
+            } else {
+                _handler->evt(evt + ":" + asprintf("%d", _win) + ":" + event);
+            }
+        } else if (evt == "rows-needed" && virtualList(j["id"].toRawString()) != nullptr) {
+            // Answer from the rows kept here, ask the host only for what is missing plus prefetch
+            std::string id = j["id"].toRawString();
+            VirtualListPtr l = virtualList(id);
+            JSON host_runs;
+            JSON runs = l->request(static_cast<int>(j["from"].toInt()), static_cast<int>(j["count"].toInt()),
+                                   host_runs);
+            WinInfo_t *i = _handler->getWinInfo(_win);
+            if (i != nullptr) {
+                for(int k = 0; k < runs.length(); k++) {
+                    i->profile->set_rows(_handler, _win, id, static_cast<int>(runs.at(k).at(0).toInt()), runs.at(k).at(1));
+                }
+            }
+            for(int k = 0; k < host_runs.length(); k++) {
+                JSON needed = JSON::Make(JSON::Class::Object);
+                needed["id"] = id;
+                needed["from"] = host_runs.at(k).at(0).toInt();
+                needed["count"] = host_runs.at(k).at(1).toInt();
+                _handler->evt(evt + ":" + asprintf("%d", _win) + ":" + needed.dump());
+            }
         } else if (evt == "page-loaded") {
+            forgetAllHtml();            // A reload or navigation rebuilt every element
+            _ready_mutex.lock();
+            if (!_queued_js.empty()) {
+                std::string script;
+                for(const std::string &code : _queued_js) {
+                    script += "try {\n" + code + "\n} catch (webui_wire_e) { console.error(webui_wire_e); }\n";
+                }
+                _handler->message(asprintf("Window %d: running %d scripts queued while loading", _win,
+                                           static_cast<int>(_queued_js.size())));
+                _queued_js.clear();
+                webui_run(_webui_win, script.c_str());
+            }
+            _ready_connection = e->connection_id;
             _page_loaded = true;
-            _handler->evt(evt + ":" + asprintf("%d", _win) + ":" + event);
+            _ready_mutex.unlock();
+            if (!_detached) {
+                _handler->evt(evt + ":" + asprintf("%d", _win) + ":" + event);
+            } else if (_companion_of > 0) {
+                _handler->evt("prerendered:" + asprintf("%d", _companion_of) + ":" + event);
+            }
+        } else if (_detached) {
+            _handler->message("Event of a detached window: " + event);
         } else {
             _handler->evt(evt + ":" + asprintf("%d", _win) + ":" + event);
         }
@@ -544,7 +974,134 @@ void WebUIWindow::handleMoveEvent(webui_event_t *e)
     _handler->windowMoved(_win, x, y);
 }
 
-WebUIWindow::WebUIWindow(WebWireHandler *h, int win, const std::string &p, bool use_browser, WebUIWindow *parent_win, Object_t *parent)
+void WebUIWindow::nativeGeometryChanged(int x, int y, int w, int h)
+{
+    _pending_pos = Point_t(x, y);
+    _pending_size = Size_t(w, h);
+
+#ifdef __linux
+    // Coalesce the stream of configure events during a move or resize
+    if (_geometry_flush_source == 0) {
+        _geometry_flush_source = g_timeout_add(NATIVE_GEOMETRY_COALESCE_MS, web_ui_wire_flush_geometry,
+                                               reinterpret_cast<gpointer>(_webui_win));
+    }
+#endif
+}
+
+void WebUIWindow::flushNativeGeometry()
+{
+    bool moved = !_geometry_reported ||
+                 _pending_pos.x() != _reported_pos.x() || _pending_pos.y() != _reported_pos.y();
+    bool resized = !_geometry_reported ||
+                   _pending_size.width() != _reported_size.width() || _pending_size.height() != _reported_size.height();
+
+    if (moved || resized) {
+        _geometry_reported = true;
+        _reported_pos = _pending_pos;
+        _reported_size = _pending_size;
+
+        // Handled by the WebWireHandler in the event loop, so it's safe from any gui thread.
+        emit(evt_window_geometry << _win
+                                 << moved << _reported_pos.x() << _reported_pos.y()
+                                 << resized << _reported_size.width() << _reported_size.height()
+             );
+    }
+}
+
+#ifdef __linux
+void WebUIWindow::clearGeometryFlushSource()
+{
+    _geometry_flush_source = 0;
+}
+#endif
+
+void WebUIWindow::watchNativeGeometry()
+{
+    if (_use_browser || _win_handle == NULL || _win_handle == _geometry_watched_handle) {
+        return;
+    }
+
+    _geometry_watched_handle = _win_handle;
+
+#ifdef __linux
+    g_signal_connect(G_OBJECT(_win_handle), "configure-event",
+                     G_CALLBACK(web_ui_wire_configure_event),
+                     reinterpret_cast<gpointer>(_webui_win));
+#endif
+#ifdef _WINDOWS
+    SetWindowSubclass(_win_handle, web_ui_wire_geometry_proc, WEB_WIRE_GEOMETRY_SUBCLASS_ID,
+                      static_cast<DWORD_PTR>(_webui_win));
+#endif
+#ifdef __APPLE__
+    watch_window_geometry_apple(_win_handle, web_ui_wire_apple_geometry, _webui_win);
+#endif
+}
+
+bool WindowSpec_t::load(const std::string &json, std::string &error)
+{
+    bool ok = true;
+    auto on_error = [&ok, &error](const std::string &msg) {
+        error = msg;
+        ok = false;
+    };
+
+    JSON j = JSON::Load(json, on_error);
+    if (!ok) {
+        return false;
+    }
+    if (j.JSONType() != JSON::Class::Object) {
+        error = "the window spec must be a json object";
+        return false;
+    }
+
+    if (j.hasKey("width") || j.hasKey("height")) {
+        size_set = j.hasKey("width") && j.hasKey("height");
+        width = static_cast<int>(j["width"].toInt());
+        height = static_cast<int>(j["height"].toInt());
+    }
+    if (j.hasKey("x") || j.hasKey("y")) {
+        pos_set = j.hasKey("x") && j.hasKey("y");
+        x = static_cast<int>(j["x"].toInt());
+        y = static_cast<int>(j["y"].toInt());
+    }
+    if (j.hasKey("title")) { title = j["title"].toRawString(); }
+    if (j.hasKey("icon")) { icon = j["icon"].toRawString(); }
+    if (j.hasKey("url")) { url = j["url"].toRawString(); }
+    if (j.hasKey("html")) { html = j["html"].toRawString(); }
+    if (j.hasKey("css")) { css = j["css"].toRawString(); }
+
+    if (!size_set && (j.hasKey("width") || j.hasKey("height"))) {
+        error = "width and height must be given together";
+        return false;
+    }
+    if (!pos_set && (j.hasKey("x") || j.hasKey("y"))) {
+        error = "x and y must be given together";
+        return false;
+    }
+    if (url != "" && html != "") {
+        error = "give either url or html, not both";
+        return false;
+    }
+    return true;
+}
+
+bool WindowSpec_t::hasContent() const
+{
+    return url != "" || html != "";
+}
+
+WindowSpec_t::WindowSpec_t()
+{
+    size_set = false;
+    width = 0;
+    height = 0;
+    pos_set = false;
+    x = 0;
+    y = 0;
+}
+
+WebUIWindow::WebUIWindow(WebWireHandler *h, int win, const std::string &p, bool use_browser, WebUIWindow *parent_win,
+                         Object_t *parent, bool hidden, const WindowSpec_t *spec, int companion_of)
     : Object_t(parent)
 {
     _win = win;
@@ -561,10 +1118,21 @@ WebUIWindow::WebUIWindow(WebWireHandler *h, int win, const std::string &p, bool
     _parent_win = parent_win;
     _disconnected = false;
     _page_loaded = false;
+    _ready_connection = 0;
+    _html_bytes = 0;
     _current_handle = -1;
     _handle_counter = 0;
     _exec_js = nullptr;
     _served = 0;
+    _start_hidden = hidden;
+    _detached = hidden;
+    _companion_of = companion_of;
+    _initial_handle = -1;
+    _geometry_watched_handle = NULL;
+    _geometry_reported = false;
+#ifdef __linux
+    _geometry_flush_source = 0;
+#endif
 
     _webui_win = webui_new_window();
     h->message(asprintf("_webui_win = %d", _webui_win));
@@ -578,7 +1146,7 @@ WebUIWindow::WebUIWindow(WebWireHandler *h, int win, const std::string &p, bool
     webui_bind(_webui_win, "", webui_event_handler);
     webui_bind(_webui_win, "web_ui_wire_handle_event", web_ui_wire_handle_event);
     webui_bind(_webui_win, "web_ui_wire_resize_event", web_ui_wire_handle_resize);
-    webui_bind(_webui_win, "web_uit_wire_move_event", web_ui_wire_handle_move);
+    webui_bind(_webui_win, "web_ui_wire_move_event", web_ui_wire_handle_move);
 
     //show(standardMessage());
 
@@ -595,7 +1163,31 @@ WebUIWindow::WebUIWindow(WebWireHandler *h, int win, const std::string &p, bool
         _base_url = std::string("http://127.0.0.1:") + m[1].str();
     }
 
-    show(_base_url);
+    if (_start_hidden) {
+        webui_set_hide(_webui_win, true);       // A pooled window, shown when it is claimed
+    }
+
+    // With a spec, the first page is the real content, in its final geometry
+    std::string first_url = _base_url;
+    if (spec != nullptr) {
+        if (spec->size_set) { resize(spec->width, spec->height); }
+        if (spec->pos_set) { move(spec->x, spec->y); }
+        if (spec->icon != "") { setWindowIcon(spec->icon); }
+        _initial_title = spec->title;
+        _initial_css = spec->css;
+        if (spec->url != "") {
+            first_url = spec->url;
+        } else if (spec->html != "") {
+            bool ok;
+            std::string url = fileUrl(spec->html, ok);
+            if (ok) {
+                first_url = url;
+            } else {
+                _handler->error("new: url for " + spec->html + " is not valid");
+            }
+        }
+    }
+    show(first_url);
 
     //_webui_port = _handler->serverPort() + _win;
     //_handler->message(asprintf("webui_set_port %d", _webui_port));
@@ -604,6 +1196,11 @@ WebUIWindow::WebUIWindow(WebWireHandler *h, int win, const std::string &p, bool
 
 WebUIWindow::~WebUIWindow()
 {
+#ifdef __linux
+    if (_geometry_flush_source != 0) {
+        g_source_remove(_geometry_flush_source);
+    }
+#endif
     _windows.erase(_webui_win);
 }
 
@@ -622,13 +1219,23 @@ void WebUIWindow::setShowState(WebUiWindow_ShowState st)
 #ifdef _WINDOWS
         HWND handle = this->nativeHandle();
         ShowWindow(handle, SW_HIDE);
-#else
+#endif
+#ifdef __linux
+        if (_win_handle != NULL) { gtk_widget_hide(GTK_WIDGET(_win_handle)); }
+#endif
+#ifdef __APPLE__
+        if (_win_handle != NULL) { show_window_apple(_win_handle, false); }
 #endif
     } else if (st == shown) {
 #ifdef _WINDOWS
         HWND handle = this->nativeHandle();
         ShowWindow(handle, SW_SHOW);
-#else
+#endif
+#ifdef __linux
+        if (_win_handle != NULL) { gtk_widget_show_all(GTK_WIDGET(_win_handle)); }
+#endif
+#ifdef __APPLE__
+        if (_win_handle != NULL) { show_window_apple(_win_handle, true); }
 #endif
     } else if (st == minimized) {
         webui_minimize(_webui_win);
@@ -676,9 +1283,168 @@ int WebUIWindow::id() const
     return _win;
 }
 
+void WebUIWindow::setId(int win)
+{
+    _win = win;
+}
+
+int WebUIWindow::currentHandle()
+{
+    return _current_handle;
+}
+
+bool WebUIWindow::inBrowser()
+{
+    return _use_browser;
+}
+
+WebUIWindow *WebUIWindow::parentWindow()
+{
+    return _parent_win;
+}
+
+bool WebUIWindow::detached()
+{
+    return _detached;
+}
+
+void WebUIWindow::attach()
+{
+    _detached = false;
+    _companion_of = -1;
+}
+
 bool WebUIWindow::disconnected()
 {
-    return _disconnected;
+    _ready_mutex.lock();
+    bool d = _disconnected;
+    _ready_mutex.unlock();
+    return d;
+}
+
+bool WebUIWindow::gone()
+{
+    // The connection state is written by webui's event thread, under _ready_mutex
+    _ready_mutex.lock();
+    bool g = _disconnected &&
+             std::chrono::steady_clock::now() - _disconnected_at > std::chrono::milliseconds(DISCONNECT_GRACE_MS);
+    _ready_mutex.unlock();
+    return g;
+}
+
+bool WebUIWindow::pageReady()
+{
+    _ready_mutex.lock();
+    bool loaded = _page_loaded;
+    _ready_mutex.unlock();
+    return loaded && !gone();
+}
+
+bool WebUIWindow::runWhenReady(const std::string &code)
+{
+    if (gone()) {
+        return false;
+    }
+
+    _ready_mutex.lock();
+    if (_page_loaded) {
+        _ready_mutex.unlock();
+        webui_run(_webui_win, code.c_str());
+        return true;
+    }
+
+    if (_queued_js.size() >= PAGE_READY_MAX_QUEUED) {
+        _queued_js.pop_front();
+        _handler->error(asprintf("Window %d: too many scripts queued while loading, dropped the oldest", _win));
+    }
+    _queued_js.push_back(code);
+    _ready_mutex.unlock();
+
+    return true;
+}
+
+bool WebUIWindow::invokeWhenReady(const std::string &call)
+{
+    if (gone()) {
+        return false;
+    }
+
+    _ready_mutex.lock();
+    if (_page_loaded) {
+        _ready_mutex.unlock();
+        webui_send_raw(_webui_win, "_web_wire_rpc_raw", call.data(), call.size());
+        return true;
+    }
+    _ready_mutex.unlock();
+
+    return runWhenReady("window._web_wire_rpc(" + call + ");");     // Queued until page-loaded
+}
+
+JSON WebUIWindow::htmlPatch(const std::string &element_id, const std::string &html, bool &full)
+{
+    HtmlNodePtr to = HtmlDiff_t::parse(html);
+    JSON ops;
+
+    _html_mutex.lock();
+    full = !_html_trees.contains(element_id);
+    if (!full) {
+        ops = HtmlDiff_t::diff(_html_trees[element_id], to);
+        full = ops.dump().size() >= html.size();        // Then the html itself is the smaller message
+        _html_bytes -= _html_sources[element_id].size();
+    }
+    if (_html_bytes + html.size() > HTML_DIFF_CACHE_MAX_BYTES) {
+        _html_trees.clear();
+        _html_sources.clear();
+        _html_bytes = 0;
+    }
+    _html_trees[element_id] = to;
+    _html_sources[element_id] = html;
+    _html_bytes += html.size();
+    _html_mutex.unlock();
+
+    return ops;
+}
+
+void WebUIWindow::forgetAllHtml()
+{
+    _html_mutex.lock();
+    _html_trees.clear();
+    _html_sources.clear();
+    _html_bytes = 0;
+    _html_mutex.unlock();
+}
+
+void WebUIWindow::setVirtualList(const std::string &element_id, VirtualListPtr l)
+{
+    _list_mutex.lock();
+    if (l == nullptr) {
+        _virtual_lists.erase(element_id);
+    } else {
+        _virtual_lists[element_id] = l;
+    }
+    _list_mutex.unlock();
+}
+
+VirtualListPtr WebUIWindow::virtualList(const std::string &element_id)
+{
+    VirtualListPtr l;
+    _list_mutex.lock();
+    if (_virtual_lists.contains(element_id)) {
+        l = _virtual_lists[element_id];
+    }
+    _list_mutex.unlock();
+    return l;
+}
+
+bool WebUIWindow::waitUntilReady(int timeout_ms)
+{
+    if (pageReady()) {
+        return true;
+    }
+
+    WebUI_Utils u;
+    u.waitUntil([this]() { return pageReady() || gone(); }, timeout_ms);
+    return pageReady();
 }
 
 #ifdef __linux
@@ -700,8 +1466,17 @@ int WebUIWindow::show(const std::string &msg_or_url)
     _in_set_html_or_url = true;
     _set_html_or_url_done = true;
     _current_handle = handle;
+    if (_initial_handle < 0) {
+        _initial_handle = handle;
+    }
 
+    _ready_mutex.lock();
     _page_loaded = false;
+    _ready_mutex.unlock();
+    forgetAllHtml();            // The elements of the previous page are gone
+    _list_mutex.lock();
+    _virtual_lists.clear();
+    _list_mutex.unlock();
 
     if (_use_browser) {
         webui_show_browser(_webui_win, msg_or_url.c_str(), webui_browser::ChromiumBased);
@@ -734,6 +1509,13 @@ int WebUIWindow::show(const std::string &msg_or_url)
     // TODO: add parent stuff.
 #endif
 
+    watchNativeGeometry();
+
+    // Shown as soon as the window is, not only when the first page has loaded
+    if (_initial_title != "" && handle == _initial_handle) {
+        setNativeTitle(_initial_title);
+    }
+
     // Wait until the window get's connected again.
     //int show_timeout = 30;
     //WebUI_Utils u;
@@ -15,6 +15,12 @@
 #include "readlineinthread.h"
 #include "webui_utils.h"
 #include "json.h"
+#include "filecache_t.h"
+#include "httpresponse_t.h"
+#include "assetbundle_t.h"
+#include "statcache_t.h"
+#include "virtualfiles_t.h"
+#include "dynamicroutes_t.h"
 
 #ifdef WIN32
 #include <nfd.h>
@@ -50,8 +56,6 @@ namespace fs = std::filesystem;
                                return; \
                             }
 
-#define js_el(id, code)     std::string("let el = document.getElementById('") + id + "');" + \
-                            std::string("if (el !== null) { ") + code + "}"
 
 defun(cmdSetUrl)
 {
@@ -85,6 +89,54 @@ defun(cmdExecJs)
     }
 }
 
+defun(cmdDefineFunction)
+{
+    int win = -1;
+    std::string name;
+    std::string function_code;
+    if (check("define-function", var(t_int, win) << var(t_string, name) << var(t_string, function_code))) {
+        checkWin;
+        if (name == "" || name.find_first_of("'\\") != std::string::npos) {
+            r_err(asprintf("define-function:%d:", win) + "invalid function name '" + name + "'");
+            r_nok(asprintf("define-function:%d", win));
+        } else {
+            h->definePageFunction(win, name, function_code);
+            r_ok(asprintf("define-function:%d:", win) + name);
+        }
+    }
+}
+
+defun(cmdInvoke)
+{
+    int win = -1;
+    std::string name;
+    std::string json_args;
+    if (check("invoke", var(t_int, win) << var(t_string, name) << opt(t_string, json_args, "[]"))) {
+        checkWin;
+
+        std::string error;
+        auto on_error = [&error](const std::string &msg) { error = msg; };
+        JSON a = JSON::Load(json_args, on_error);
+        if (error != "") {
+            r_err(asprintf("invoke:%d:", win) + "arguments are not valid json: " + error);
+            r_nok(asprintf("invoke:%d", win));
+            return;
+        }
+        if (a.JSONType() != JSON::Class::Array) {
+            a = Array(a);
+        }
+
+        bool ok;
+        std::string result;
+        h->invoke(win, name, a, ok, result);
+        if (ok) {
+            r_ok(asprintf("invoke:%d:", win) + ExecJs::esc_dquote(result));
+        } else {
+            r_nok(asprintf("invoke:%d", win));
+        }
+    }
+}
+
 defun(cmdUseBrowser)
 {
     int win = -1;
@@ -104,9 +156,15 @@ defun(cmdSetHtml)
     if (check("set-html", var(t_int, win) << var(t_string, file))) {
         checkWin;
 
-        FileInfo_t f(file);
-        if (f.exists()) {
-            if (!f.isReadable()) {
+        FileStat_t f;
+        if (VirtualFiles_t::shared().get(file)) {
+            f.exists = true;
+            f.readable = true;
+        } else {
+            StatCache_t::shared().stat(file, f);
+        }
+        if (f.exists) {
+            if (!f.readable) {
                 r_err(asprintf("set-html:%d:file ", win) + file + " is not readable");
                 r_nok(asprintf("set-html:%d", win));
             } else {
@@ -144,18 +202,67 @@ defun(cmdSetHtml)
     }
 }
 
+defun(cmdPrerender)
+{
+    int win = -1;
+    std::string file;
+    if (check("prerender", var(t_int, win) << var(t_string, file))) {
+        checkWin;
+
+        FileStat_t f;
+        if (VirtualFiles_t::shared().get(file)) {
+            f.exists = true;
+            f.readable = true;
+        } else {
+            StatCache_t::shared().stat(file, f);
+        }
+        if (!f.exists || !f.readable) {
+            r_err(asprintf("prerender:%d:file ", win) + file + " does not exist or is not readable");
+            r_nok(asprintf("prerender:%d", win));
+            return;
+        }
+
+        std::string error;
+        int handle = h->prerender(win, file, error);
+        if (handle >= 0) {
+            r_ok(asprintf("prerender:%d:%d", win, handle));
+        } else {
+            if (error != "") {
+                r_err(asprintf("prerender:%d:", win) + error);
+            }
+            r_nok(asprintf("prerender:%d", win));
+        }
+    }
+}
+
+defun(cmdSwap)
+{
+    int win = -1;
+    if (check("swap", var(t_int, win))) {
+        checkWin;
+
+        std::string error;
+        int handle = h->swapPrerendered(win, error);
+        if (handle >= 0) {
+            r_ok(asprintf("swap:%d:%d", win, handle));
+        } else {
+            r_nok(asprintf("swap:%d:", win) + ((error == "") ? std::string("nothing prerendered") : error));
+        }
+    }
+}
+
 defun(cmdSetInnerHtml)
 {
     int win = -1;
     std::string id;
     std::string data;
-    if (check("set-inner-html", var(t_int, win) << var(t_string, id) << var(t_string, data))) {
-        FileInfo_t f(data);
+    bool diff = false;
+    if (check("set-inner-html", var(t_int, win) << var(t_string, id) << var(t_string, data) << opt(t_bool, diff, false))) {
         bool is_file = false;
-        if (f.exists()) {
-            if (f.isReadable()) {
-                is_file = true;
-            }
+        if (StatCache_t::plausiblePath(data)) {                 // Html is never looked up on disk
+            FileStat_t f;
+            StatCache_t::shared().stat(data, f);
+            is_file = (f.exists && f.readable) || VirtualFiles_t::shared().get(data) != nullptr;
         }
 
         checkWin;
@@ -165,7 +272,16 @@ defun(cmdSetInnerHtml)
 
         WinInfo_t *i = h->getWinInfo(win);
         int handle = w->newHandle();
-        if (is_file) {
+        if (diff && !is_file && !utils.checkUrl(data)) {
+            bool full;
+            JSON ops = w->htmlPatch(id, data, full);
+            if (full) {
+                i->profile->set_html(h, win, handle, id, data, false);
+            } else {
+                i->profile->patch_html(h, win, handle, id, ops);
+            }
+        } else if (is_file) {
+            w->forgetAllHtml();         // The new content may hold, or sit inside, elements kept for diffing
             std::string base_url = w->baseUrl();
             data = utils.encodeUrl(data);
             std::string url = base_url + data;
@@ -176,6 +292,7 @@ defun(cmdSetInnerHtml)
                 ok = false;
             }
         } else {
+            w->forgetAllHtml();
             if (utils.checkUrl(data)) {
                 std::string p_url = utils.normalizeUrl(data);
                 i->profile->set_html(h, win, handle, id, p_url, true);
@@ -193,6 +310,266 @@ defun(cmdSetInnerHtml)
     }
 }
 
+static void insertHtml(const std::string &cmd, WebWireHandler *h, int win, const std::string &id,
+                       const std::string &position, const std::string &html, int max_children)
+{
+    checkWin;
+
+    if (position != "beforebegin" && position != "afterbegin" && position != "beforeend" && position != "afterend") {
+        r_err(cmd + asprintf(":%d:", win) + "position must be beforebegin, afterbegin, beforeend or afterend");
+        r_nok(cmd + asprintf(":%d", win));
+        return;
+    }
+
+    w->forgetAllHtml();             // Also beforebegin/afterend, which change the parent of id
+    WinInfo_t *i = h->getWinInfo(win);
+    i->profile->insert_html(h, win, id, position, html, max_children);
+    r_ok(cmd + asprintf(":%d", win));
+}
+
+defun(cmdAppendHtml)
+{
+    int win = -1;
+    std::string id;
+    std::string html;
+    int max_children = 0;
+    if (check("append-html", var(t_int, win) << var(t_string, id) << var(t_string, html) << opt(t_int, max_children, 0))) {
+        insertHtml(cmd, h, win, id, "beforeend", html, max_children);
+    }
+}
+
+defun(cmdPrependHtml)
+{
+    int win = -1;
+    std::string id;
+    std::string html;
+    int max_children = 0;
+    if (check("prepend-html", var(t_int, win) << var(t_string, id) << var(t_string, html) << opt(t_int, max_children, 0))) {
+        insertHtml(cmd, h, win, id, "afterbegin", html, max_children);
+    }
+}
+
+defun(cmdInsertHtml)
+{
+    int win = -1;
+    std::string id;
+    std::string position;
+    std::string html;
+    int max_children = 0;
+    if (check("insert-html", var(t_int, win) << var(t_string, id) << var(t_string, position) << var(t_string, html)
+                             << opt(t_int, max_children, 0))) {
+        insertHtml(cmd, h, win, id, position, html, max_children);
+    }
+}
+
+defun(cmdTransaction)
+{
+    int win = -1;
+    std::string ops;
+    if (check("transaction", var(t_int, win) << var(t_string, ops))) {
+        checkWin;
+
+        std::string error;
+        bool sets_html = false;
+        auto on_error = [&error](const std::string &msg) { error = msg; };
+        JSON j = JSON::Load(ops, on_error);
+        if (error == "" && j.JSONType() != JSON::Class::Array) {
+            error = "expected a list of operations";
+        }
+        for(int k = 0; error == "" && k < j.length(); k++) {
+            const JSON &op = j.at(k);
+            int n = (op.JSONType() == JSON::Class::Array && op.length() > 0) ?
+                        WebWireProfile::transactionOpArgs(op.at(0).toString()) : -1;
+            if (n < 0) {
+                error = asprintf("operation %d is not one of set-attr, del-attr, set-style, add-style, add-class, "
+                                 "remove-class or set-inner-html", k);
+            } else if (op.length() != n + 1) {
+                error = asprintf("operation %d needs %d arguments", k, n);
+            } else if (op.at(0).toString() == "set-inner-html") {
+                sets_html = true;
+            }
+        }
+        if (error != "") {
+            r_err(asprintf("transaction:%d:", win) + error);
+            r_nok(asprintf("transaction:%d", win));
+            return;
+        }
+        if (sets_html) {
+            w->forgetAllHtml();         // Only now that the transaction will be sent
+        }
+
+        WinInfo_t *i = h->getWinInfo(win);
+        int handle = w->newHandle();
+        i->profile->transaction(h, win, handle, j);
+        r_ok(asprintf("transaction:%d:%d", win, handle));
+    }
+}
+
+defun(cmdQuery)
+{
+    int win = -1;
+    std::string requests;
+    if (check("query", var(t_int, win) << var(t_string, requests))) {
+        checkWin;
+
+        std::string error;
+        auto on_error = [&error](const std::string &msg) { error = msg; };
+        JSON j = JSON::Load(requests, on_error);
+        if (error == "" && j.JSONType() != JSON::Class::Array) {
+            error = "expected a list of [<id or selector>, <property>]";
+        }
+        for(int k = 0; error == "" && k < j.length(); k++) {
+            const JSON &r = j.at(k);
+            if (r.JSONType() != JSON::Class::Array || r.length() != 2 ||
+                r.at(0).JSONType() != JSON::Class::String || r.at(1).JSONType() != JSON::Class::String) {
+                error = asprintf("request %d is not a [<id or selector>, <property>] pair", k);
+            }
+        }
+        if (error != "") {
+            r_err(asprintf("query:%d:", win) + error);
+            r_nok(asprintf("query:%d", win));
+            return;
+        }
+
+        WinInfo_t *i = h->getWinInfo(win);
+        bool ok;
+        std::string result = i->profile->query(h, win, j, ok);
+        if (ok) {
+            r_ok(asprintf("query:%d:", win) + ExecJs::esc_dquote(result));
+        } else {
+            r_nok(asprintf("query:%d", win));
+        }
+    }
+}
+
+static int specInt(const JSON &spec, const std::string &key, int def, int min, std::string &error)
+{
+    if (!spec.hasKey(key)) {
+        return def;
+    }
+    const JSON &v = spec.at(key);
+    if (v.JSONType() != JSON::Class::Integral || v.toInt() < min) {
+        error = asprintf("'%s' must be an integer >= %d", key.c_str(), min);
+        return def;
+    }
+    return static_cast<int>(v.toInt());
+}
+
+defun(cmdVirtualList)
+{
+    int win = -1;
+    std::string id;
+    std::string spec_json;
+    if (check("virtual-list", var(t_int, win) << var(t_string, id) << var(t_string, spec_json))) {
+        checkWin;
+
+        std::string error;
+        auto on_error = [&error](const std::string &msg) { error = msg; };
+        JSON spec = JSON::Load(spec_json, on_error);
+        if (error == "" && spec.JSONType() != JSON::Class::Object) {
+            error = "expected a json object";
+        }
+        if (error == "" && !spec.hasKey("rows")) {
+            error = "'rows' is required";
+        }
+        JSON page_spec = JSON::Make(JSON::Class::Object);
+        int cache = 0, prefetch = 0;
+        if (error == "") {
+            page_spec["rows"] = specInt(spec, "rows", 0, 0, error);
+            page_spec["row_height"] = specInt(spec, "row_height", 24, 1, error);
+            page_spec["overscan"] = specInt(spec, "overscan", 10, 0, error);
+            page_spec["keep"] = specInt(spec, "keep", 2000, 100, error);
+            cache = specInt(spec, "cache", 0, 0, error);
+            prefetch = specInt(spec, "prefetch", (cache > 0) ? 100 : 0, 0, error);
+            page_spec["html"] = spec.hasKey("html") && spec.at("html").toBool();
+            page_spec["columns"] = spec.hasKey("columns") ? spec.at("columns") : JSON::Make(JSON::Class::Array);
+            if (page_spec["columns"].JSONType() != JSON::Class::Array) {
+                error = "'columns' must be a list";
+            }
+        }
+        if (error != "") {
+            r_err(asprintf("virtual-list:%d:", win) + error);
+            r_nok(asprintf("virtual-list:%d", win));
+            return;
+        }
+
+        // With a cache, webui-wire answers rows-needed from the rows it kept and asks the host
+        // only for the rest, widened by prefetch
+        w->setVirtualList(id, (cache > 0) ? std::make_shared<VirtualList_t>(static_cast<int>(page_spec["rows"].toInt()),
+                                                                             cache, prefetch)
+                                          : nullptr);
+        w->forgetAllHtml();         // The rows replace the content of id
+
+        WinInfo_t *i = h->getWinInfo(win);
+        i->profile->virtual_list(h, win, id, page_spec);
+        r_ok(asprintf("virtual-list:%d:", win) + id);
+    }
+}
+
+defun(cmdSetRows)
+{
+    int win = -1;
+    std::string id;
+    int from = 0;
+    std::string rows_json;
+    if (check("set-rows", var(t_int, win) << var(t_string, id) << var(t_int, from) << var(t_string, rows_json))) {
+        checkWin;
+
+        std::string error;
+        auto on_error = [&error](const std::string &msg) { error = msg; };
+        JSON rows = JSON::Load(rows_json, on_error);
+        if (error == "" && rows.JSONType() != JSON::Class::Array) {
+            error = "expected a list of rows";
+        }
+        if (error == "" && from < 0) {
+            error = "<from> must be >= 0";
+        }
+        if (error != "") {
+            r_err(asprintf("set-rows:%d:", win) + error);
+            r_nok(asprintf("set-rows:%d", win));
+            return;
+        }
+
+        WinInfo_t *i = h->getWinInfo(win);
+        VirtualListPtr l = w->virtualList(id);
+        if (l == nullptr) {
+            i->profile->set_rows(h, win, id, from, rows);
+        } else {
+            // Prefetched rows stay here until the page scrolls to them
+            JSON runs = l->put(from, rows);
+            for(int k = 0; k < runs.length(); k++) {
+                i->profile->set_rows(h, win, id, static_cast<int>(runs.at(k).at(0).toInt()), runs.at(k).at(1));
+            }
+        }
+        r_ok(asprintf("set-rows:%d:%d", win, rows.length()));
+    }
+}
+
+defun(cmdSetRowCount)
+{
+    int win = -1;
+    std::string id;
+    int rows = 0;
+    bool reset = false;
+    if (check("set-row-count", var(t_int, win) << var(t_string, id) << var(t_int, rows) << opt(t_bool, reset, false))) {
+        checkWin;
+
+        if (rows < 0) {
+            r_err(asprintf("set-row-count:%d:<rows> must be >= 0", win));
+            r_nok(asprintf("set-row-count:%d", win));
+            return;
+        }
+
+        VirtualListPtr l = w->virtualList(id);
+        if (l != nullptr) {
+            l->setRowCount(rows, reset);
+        }
+        WinInfo_t *i = h->getWinInfo(win);
+        i->profile->set_row_count(h, win, id, rows, reset);
+        r_ok(asprintf("set-row-count:%d:%d", win, rows));
+    }
+}
+
 defun(cmdGetInnerHtml)
 {
     int win = -1;
@@ -365,21 +742,7 @@ defun(cmdOn)
     if (check("on", var(t_int, win) << var(t_string, event) << var(t_string, id))) {
         checkWin;
 
-        id = replace(id, "'", "\\'");
-        std::string js_set_on_evt   = "{"
-                                  "  let el = document.getElementById('" + id + "');"
-                                  "  if (el !== undefined) {"
-                                  "     el.addEventListener("
-                                  "        '" + event + "', "
-                                  "        function(e) {"
-                                  "           let obj = {evt: '" + event + "', id: '" + id +"', js_evt: window._web_wire_event_info('" + event + "', '" + id + "', e) };"
-                                  "           window._web_wire_put_evt(obj);"
-                                  "        }"
-                                  "     );"
-                                  "  }"
-                                  "}";
-
-        h->execJs(win, js_set_on_evt, "on");
+        h->invoke(win, "on", Array(event, id));
         r_ok(asprintf("on:%d:%s", win, event.c_str()));
     }
 }
@@ -393,13 +756,9 @@ defun(cmdBind)
     if (check("bind", var(t_int, win) << var(t_string, event) << var(t_string, selector))) {
         checkWin;
 
-        selector = replace(selector, "'", "\\'");
-        event = replace(event, "'", "\\'");
-
-        std::string js_bind_evt = "return window._web_wire_bind_evt_ids('" + selector + "', '" + event + "');";
         bool ok;
         std::string result;
-        h->execJs(win, js_bind_evt, ok, result, "bind");
+        h->invoke(win, "bind", Array(selector, event), ok, result);
         if (ok) {
             r_ok(asprintf("bind:%d:", win) + ExecJs::esc_dquote(result));
         } else {
@@ -416,26 +775,9 @@ defun(cmdElementInfo)
     if (check("element-info", var(t_int, win) << var(t_string, id))) {
         checkWin;
 
-        std::string _id = id;
-        _id = replace(_id, "'", "\\'");
-
-        std::string js = "{"
-                     "  let el = document.getElementById('" + _id + "');"
-                     "  let obj;"
-                     "  if ((el === null) || (el === undefined)) {"
-                     "    obj = [ '" + _id + "', '', '', false ];"
-                     "  } else {"
-                     "    let type = el.getAttribute('type');"
-                     "    if (type === null) { type = ''; }"
-                     "    obj = [ '" + _id + "', el.nodeName, type, true ];"
-                     "  }"
-                     "  let ret = 'json:' + JSON.stringify(obj);"
-                     "  return ret;"
-                     "}";
-
         bool ok;
         std::string result;
-        h->execJs(win, js, ok, result, "element-info");
+        h->invoke(win, "element-info", Array(id), ok, result);
         if (ok) {
             id = ExecJs::esc_dquote(id);
             r_ok(asprintf("element-info:%d:", win) + ExecJs::esc_dquote(result));
@@ -455,30 +797,11 @@ defun(cmdValue)
     if (check("value", var(t_int, win) << var(t_string, id) << opt(t_string, val, dummy))) {
         checkWin;
 
-        std::string _id = id;
-        _id = replace(_id, "'", "\\'");
-
-        std::string js_value;
-        if (val == dummy) {
-            js_value = "{"
-                       "   let el = document.getElementById('" + _id + "');"
-                       "   return el.value;"
-                       "}";
-        } else {
-            val = replace(val, "'", "\\'");
-
-            h->message(std::string("cmdValue: got ##") + val + "##");
-
-            js_value = "{"
-                       "   let el = document.getElementById('" + _id + "');"
-                       "   el.value = '" + val + "';"
-                       "   return el.value;"
-                       "}";
-        }
+        bool set = (val != dummy);
         bool ok;
         std::string result;
 
-        h->execJs(win, js_value, ok, result, "value");
+        h->invoke(win, "value", Array(id, set, set ? val : std::string("")), ok, result);
         id = ExecJs::esc_dquote(id);
         if (ok) {
             r_ok(asprintf("value:%d:", win) + id + ":" + ExecJs::esc_dquote(result));
@@ -497,24 +820,7 @@ defun(cmdAddClass)
     if (check(cmd, var(t_int, win) << var(t_string, id) << var(t_string, cl))) {
         checkWin;
 
-        std::string _id = id;
-        _id = replace(_id, "'", "\\'");
-
-        std::string _cl = cl;
-        _cl = replace(_cl, "'", "\\'");
-
-        std::string js = std::string("{") +
-                     js_el(_id,
-                        "let cl = el.getAttribute('class');"
-                        "if (cl === null) { cl = ''; }"
-                        "let _cl = '" + _cl + "';"
-                        "cl = cl.replace(_cl, '');"
-                        "cl += ' ' + _cl;"
-                        "cl = cl.replace(/\\s+/g, ' ');"
-                        "el.setAttribute('class', cl);"
-                    ) + "}";
-
-        h->execJs(win, js, "add-class");
+        h->invoke(win, "add-class", Array(id, cl));
         r_ok(asprintf("add-class:%d", win));
     }
 }
@@ -528,22 +834,7 @@ defun(cmdRemoveClass)
     if (check(cmd, var(t_int, win) << var(t_string, id) << var(t_string, cl))) {
         checkWin;
 
-        std::string _id = id;
-        _id = replace(_id, "'", "\\'");
-
-        std::string _cl = cl;
-        _cl = replace(_cl, "'", "\\'");
-
-        std::string js = std::string("{") +
-                     js_el(_id,
-                           "let cl = el.getAttribute('class');"
-                           "if (cl === null) { cl = ''; }"
-                           "let _cl = '" + _cl + "';"
-                           "cl = cl.replace(_cl, '');"
-                           "cl = cl.replace(/\\s+/g, ' ');"
-                           "el.setAttribute('class', cl);"
-                    ) + "}";
-        h->execJs(win, js, "remove-class");
+        h->invoke(win, "remove-class", Array(id, cl));
         r_ok(asprintf("remove-class:%d", win));
     }
 }
@@ -689,19 +980,20 @@ defun(cmdSetIcon)
     if (check("set-icon", var(t_int, win) << var(t_string, icon_file))) {
         checkWin
 
-        FileInfo_t f(icon_file);
-        if (f.exists() && f.isReadable()) {
+        FileStat_t f;
+        StatCache_t::shared().stat(icon_file, f);
+        if (f.exists && f.readable) {
             //QIcon icn(icon_file);
             h->setWindowIcon(win, icon_file);
             r_ok(asprintf("set-icon:%d", win));
         } else {
-            if (!f.exists()) {
+            if (!f.exists) {
                 r_err(asprintf("set-icon:%d:Icon File '", win) + icon_file + "' does not exist");
                 r_nok(asprintf("set-icon:%d", win));
                 return;
             }
 
-            if (!f.isReadable()) {
+            if (!f.readable) {
                 r_err(asprintf("set-icon:%d:Icon file '", win) + icon_file + "' is not readable");
                 r_nok(asprintf("set-icon:%d", win));
                 return;
@@ -785,12 +1077,59 @@ defun(cmdNewWindow)
     int parent_win_id = -1;
     int win = 0;
     bool in_browser = false;
-    if (check("new", var(t_string, profile) << opt(t_bool, in_browser, false) << opt(t_int, parent_win_id, -1))) {
-        int win = h->newWindow(profile, in_browser, parent_win_id);
+    std::string spec_json;
+    if (check("new", var(t_string, profile) << opt(t_bool, in_browser, false) << opt(t_int, parent_win_id, -1)
+                     << opt(t_string, spec_json, ""))) {
+        WindowSpec_t spec;
+        if (trim_copy(spec_json) != "") {
+            std::string error;
+            if (!spec.load(spec_json, error)) {
+                r_err("new: invalid window spec: " + error);
+                r_nok("new:0:invalid window spec");
+                return;
+            }
+            if (spec.html != "") {
+                FileStat_t f;
+                if (VirtualFiles_t::shared().get(spec.html)) {
+                    f.exists = true;
+                    f.readable = true;
+                } else {
+                    StatCache_t::shared().stat(spec.html, f);
+                }
+                if (!f.exists || !f.readable) {
+                    r_err("new: file " + spec.html + " does not exist or is not readable");
+                    r_nok("new:0:" + spec.html);
+                    return;
+                }
+            }
+            if (spec.url != "") {
+                WebUI_Utils utils;
+                if (!utils.checkUrl(spec.url)) {
+                    r_err("new: url " + spec.url + " is not valid");
+                    r_nok("new:0:" + spec.url);
+                    return;
+                }
+                spec.url = utils.normalizeUrl(spec.url);
+            }
+        }
+        int win = h->newWindow(profile, in_browser, parent_win_id, (trim_copy(spec_json) != "") ? &spec : nullptr);
         r_ok(asprintf("new:%d:%d", win, win));
     }
 }
 
+defun(cmdWindowPool)
+{
+    std::string profile;
+    int size;
+    int win = 0;
+    if (check("window-pool", var(t_string, profile) << opt(t_int, size, -1))) {
+        if (size >= 0) {
+            h->setWindowPool(profile, size);
+        }
+        r_ok("window-pool:0:" + h->windowPoolStats().dump());
+    }
+}
+
 defun(cmdShow)
 {
     int win = -1;
@@ -884,11 +1223,159 @@ defun(cmdGetStyleheet)
     r_ok(std::string("get-stylesheet:0:") + js);
 }
 
+defun(cmdCacheStats)
+{
+    JSON j;
+    j["files"] = FileCache_t::shared().stats();
+    j["stat"] = StatCache_t::shared().stats();
+    j["virtual"] = VirtualFiles_t::shared().stats();
+    j["routes"] = DynamicRoutes_t::shared().stats();
+    r_ok(std::string("cache-stats:0:") + j.dump());
+}
+
+defun(cmdCacheControl)
+{
+    std::string prefix;
+    std::string policy;
+    int win = 0;
+    if (check("cache-control", var(t_string, prefix) << opt(t_string, policy, ""))) {
+        HttpResponse_t::setCacheControl(prefix, trim_copy(policy));
+        FileCache_t::shared().clear();      // Cached responses carry the previous policy
+        r_ok("cache-control:0:" + HttpResponse_t::cacheControl(prefix));
+    }
+}
+
+defun(cmdPutFile)
+{
+    std::string path;
+    std::string mimetype;
+    std::string payload;
+    int ttl;
+    int win = 0;
+    if (check("put-file", var(t_string, path) << var(t_string, mimetype) << var(t_string, payload) << opt(t_int, ttl, 0))) {
+        std::string type = trim_copy(mimetype);
+        std::string data;
+        if (type.ends_with(";base64")) {     // Binary content, e.g. image/png;base64
+            type = trim_copy(type.substr(0, type.size() - 7));
+            if (!base64_decode(payload, data)) {
+                r_err("put-file: payload for " + path + " is not valid base64");
+                r_nok("put-file:0:" + path);
+                return;
+            }
+        } else {
+            data = payload;
+        }
+        VirtualFiles_t::shared().put(path, type, data, ttl);
+        r_ok("put-file:0:" + VirtualFiles_t::normalizedPath(path));
+    }
+}
+
+defun(cmdDeleteFile)
+{
+    std::string path;
+    int win = 0;
+    if (check("delete-file", var(t_string, path))) {
+        if (VirtualFiles_t::shared().remove(path)) {
+            r_ok("delete-file:0:" + VirtualFiles_t::normalizedPath(path));
+        } else {
+            r_nok("delete-file:0:" + VirtualFiles_t::normalizedPath(path) + " does not exist");
+        }
+    }
+}
+
+defun(cmdRoute)
+{
+    std::string prefix;
+    int timeout_ms;
+    int win = 0;
+    if (check("route", var(t_string, prefix) << opt(t_int, timeout_ms, DYNAMIC_ROUTE_TIMEOUT_MS))) {
+        DynamicRoutes_t::shared().addRoute(prefix, timeout_ms);
+        r_ok("route:0:" + DynamicRoutes_t::normalizedPrefix(prefix));
+    }
+}
+
+defun(cmdUnroute)
+{
+    std::string prefix;
+    int win = 0;
+    if (check("unroute", var(t_string, prefix))) {
+        if (DynamicRoutes_t::shared().removeRoute(prefix)) {
+            r_ok("unroute:0:" + DynamicRoutes_t::normalizedPrefix(prefix));
+        } else {
+            r_nok("unroute:0:" + DynamicRoutes_t::normalizedPrefix(prefix) + " is not routed");
+        }
+    }
+}
+
+defun(cmdRespond)
+{
+    int id;
+    int code;
+    std::string mimetype;
+    std::string cache_control;
+    std::string payload;
+    int win = 0;
+    if (check("respond", var(t_int, id) << var(t_int, code) << var(t_string, mimetype) << var(t_string, cache_control)
+                         << var(t_string, payload))) {
+        std::string type = trim_copy(mimetype);
+        std::string data;
+        if (type.ends_with(";base64")) {
+            type = trim_copy(type.substr(0, type.size() - 7));
+            if (!base64_decode(payload, data)) {
+                r_err(asprintf("respond: payload for request %d is not valid base64", id));
+                r_nok(asprintf("respond:0:%d", id));
+                return;
+            }
+        } else {
+            data = payload;
+        }
+        if (DynamicRoutes_t::shared().respond(id, code, type, trim_copy(cache_control), data)) {
+            r_ok(asprintf("respond:0:%d", id));
+        } else {
+            r_nok(asprintf("respond:0:%d unknown or timed out request", id));
+        }
+    }
+}
+
+defun(cmdMountBundle)
+{
+    std::string prefix;
+    std::string bundle_file;
+    int win = 0;
+    if (check("mount-bundle", var(t_string, prefix) << var(t_string, bundle_file))) {
+        std::string error;
+        size_t count;
+        if (AssetBundle_t::mount(prefix, bundle_file, error, count)) {
+            r_ok(asprintf("mount-bundle:0:%d", static_cast<int>(count)));
+        } else {
+            r_err("mount-bundle: " + error);
+            r_nok("mount-bundle:0:" + error);
+        }
+    }
+}
+
+defun(cmdUnmountBundle)
+{
+    std::string prefix;
+    int win = 0;
+    if (check("unmount-bundle", var(t_string, prefix))) {
+        if (AssetBundle_t::unmount(prefix)) {
+            r_ok("unmount-bundle:0:" + AssetBundle_t::normalizedPrefix(prefix));
+        } else {
+            r_nok("unmount-bundle:0:" + AssetBundle_t::normalizedPrefix(prefix) + " is not mounted");
+        }
+    }
+}
+
 defun(cmdHelp)
 {
-    msg("new <profile> [<win-id>] -> <win-id> - opens a new web wire window with given profile (for cookie storage).");
-    msg("                                       The optional <win-id> is a parent window, in which case a modal dialog");
-    msg("                                       will be created.");
+    msg("new <profile> [<in-browser>] [<win-id>] [<spec>] -> <win-id> - opens a new web wire window with given profile");
+    msg("                                       (for cookie storage). The optional <win-id> is a parent window, in which");
+    msg("                                       case a modal dialog will be created. <spec> is json with width, height, x,");
+    msg("                                       y, title, icon, url or html (a file) and css, applied before the first show");
+    msg("                                       The css replaces the profile's stylesheet on the first page only");
+    msg("window-pool <profile> [<size>] -> <stats> - keeps <size> hidden, ready windows for <profile> that 'new'");
+    msg("                                              claims. The pool refills in the background, 0 disables it");
     msg("close <win> - closes window <win>. It cannot be used after that");
     msg("move <win> <x> <y> - moves window <win> to screen coordinates x, y");
     msg("resize win <width> <height> - resizes window <win> to width, height");
@@ -897,12 +1384,62 @@ defun(cmdHelp)
     msg("");
     msg("set-url <win-id> <url> - set webviewer <win-id> to load the given <url>");
     msg("set-html <win-id> <file> - set the html content of the web-wire window <win-id> to file <file>.");
-    msg("set-inner-html <win-id> <id> <file|html> - set the inner html of the dom element with id <id> to the contents of <html|file>.");
+    msg("prerender <win-id> <file> -> <handle> - loads <file> in a hidden companion window (a second OS window) of");
+    msg("                                         <win-id>, a 'prerendered:<win-id>:...' event follows when it has loaded");
+    msg("swap <win-id> -> <handle> - shows the prerendered page in place of the current one of <win-id>. The");
+    msg("                            companion's native window replaces the window, so focus and the taskbar");
+    msg("                            entry move to a new OS window. Not for in-browser, modal or parent windows");
+    msg("set-inner-html <win-id> <id> <file|html> [<diff>] - set the inner html of the dom element with id <id> to the contents of <html|file>.");
+    msg("                                                    With <diff> true, html is compared with what was last set");
+    msg("                                                    this way and only the differences are applied. Children are");
+    msg("                                                    matched on tag and id or data-key");
     msg("get-inner-html <win-id> <id> - get the inner html of the dom element with id <id>.");
+    msg("append-html <win-id> <id> <html> [<max-children>] - adds <html> at the end of element <id>. With <max-children>,");
+    msg("                                                    the first children are dropped beyond that number");
+    msg("prepend-html <win-id> <id> <html> [<max-children>] - adds <html> at the start, dropping the last children");
+    msg("insert-html <win-id> <id> <position> <html> [<max-children>] - inserts <html> at <position> (beforebegin,");
+    msg("                                                    afterbegin, beforeend or afterend) of element <id>, the");
+    msg("                                                    element keeps at most <max-children> for afterbegin and");
+    msg("                                                    beforeend, the sibling positions are not capped");
+    msg("query <win-id> <json-requests> -> <json> - reads a list of [<id or selector>, <property>] in one call. <property>");
+    msg("                                            is value, checked, html, text, exists, attrs, attr:<name>,");
+    msg("                                            style:<name>, computed:<name> or form (all named controls)");
+    msg("transaction <win-id> <json-ops> -> <handle> - applies a list of [<op>, <id>, <args>...] in one animation");
+    msg("                                               frame. <op> is set-attr, del-attr, set-style, add-style,");
+    msg("                                               add-class, remove-class or set-inner-html (html only). A");
+    msg("                                               'transaction-applied' event with handle, applied and failed follows");
+    msg("virtual-list <win-id> <id> <json-spec> - renders only the visible rows of element <id>. <json-spec> has rows,");
+    msg("                                          row_height (24), overscan (10), columns, html (false), keep (2000");
+    msg("                                          rows in the page), cache (rows kept in webui-wire, 0) and prefetch");
+    msg("                                          (100 with a cache). Missing rows come as 'rows-needed' events with");
+    msg("                                          id, from and count; a click gives 'row-clicked' with id and row");
+    msg("set-rows <win-id> <id> <from> <json-rows> - supplies rows of virtual-list <id>, a row is a value or a list of cells");
+    msg("set-row-count <win-id> <id> <rows> [<reset>] - changes the number of rows, <reset> drops all rows supplied so far");
     msg("");
     msg("on <win-id> <event> <id> - make the <id> of the html of <win-id> trigger a <event>, ");
     msg("                           event can be any javascript DOM event, e.g. click, input, mousemove, etc.");
     msg("value <win-id> <id> [<value>] - get or set the value of id, always returns the current value by event");
+    msg("define-function <win-id> <name> <function> - registers the javascript function expression <function> as page");
+    msg("                                             function <name> in all pages of the profile of <win-id>");
+    msg("invoke <win-id> <name> [<json-args>] - calls page function <name> with the arguments in json array <json-args>");
+    msg("");
+    msg("cache-stats - returns the hit/miss/byte counters of the shared content and file metadata caches as json");
+    msg("cache-control <url-path-prefix> [<policy>] - sets the Cache-Control header for files under <url-path-prefix>");
+    msg("                                             (longest prefix wins, default none). No policy removes it.");
+    msg("put-file <path> <mimetype> <payload> [<ttl-seconds>] - serves <payload> from memory at url <path>, replacing");
+    msg("                                                      what was there. Use <mimetype>;base64 for binary data");
+    msg("delete-file <path> - removes a file put with put-file");
+    msg("route <url-path-prefix> [<timeout-ms>] - requests for urls under <url-path-prefix> are sent as");
+    msg("                                         request:<win>:<json> events with id, route and path.");
+    msg("                                         The prefix itself without its trailing / is routed too.");
+    msg("                                         Routing again drops the cached answers of the route");
+    msg("unroute <url-path-prefix> - stops routing <url-path-prefix> to the host");
+    msg("respond <id> <code> <mimetype> <cache-control> <payload> - answers request <id>. Answers with a max-age in");
+    msg("                                                           <cache-control> are served from memory until they");
+    msg("                                                           expire. Use <mimetype>;base64 for binary data");
+    msg("mount-bundle <url-path-prefix> <bundle-file> -> <entries> - serves the files of a packed asset bundle");
+    msg("                                                            (see webui-wire-pack) under <url-path-prefix>");
+    msg("unmount-bundle <url-path-prefix> - stops serving the bundle mounted at <url-path-prefix>");
     msg("");
     msg("exit - exit web racket");
 
@@ -934,11 +1471,24 @@ void WebWireHandler::processCommand(const std::string &cmd, const std::stringlis
     efun("set-title", cmdSetTitle)
     efun("set-icon", cmdSetIcon)
     efun("new", cmdNewWindow)
+    efun("window-pool", cmdWindowPool)
     efun("set-html", cmdSetHtml)
+    efun("prerender", cmdPrerender)
+    efun("swap", cmdSwap)
     efun("show", cmdShow)
     efun("exec-js", cmdExecJs)
+    efun("define-function", cmdDefineFunction)
+    efun("invoke", cmdInvoke)
     efun("set-inner-html", cmdSetInnerHtml)
     efun("get-inner-html", cmdGetInnerHtml)
+    efun("transaction", cmdTransaction)
+    efun("append-html", cmdAppendHtml)
+    efun("prepend-html", cmdPrependHtml)
+    efun("insert-html", cmdInsertHtml)
+    efun("query", cmdQuery)
+    efun("virtual-list", cmdVirtualList)
+    efun("set-rows", cmdSetRows)
+    efun("set-row-count", cmdSetRowCount)
     efun("set-attr", cmdSetAttr)
     efun("get-attr", cmdGetAttr)
     efun("get-attrs", cmdGetAttrs)
@@ -967,6 +1517,15 @@ void WebWireHandler::processCommand(const std::string &cmd, const std::stringlis
     efun("choose-dir", cmdChooseDir)
     efun("use-browser", cmdUseBrowser)
     efun("loglevel", cmdLogLevel)
+    efun("cache-stats", cmdCacheStats)
+    efun("cache-control", cmdCacheControl)
+    efun("put-file", cmdPutFile)
+    efun("delete-file", cmdDeleteFile)
+    efun("route", cmdRoute)
+    efun("unroute", cmdUnroute)
+    efun("respond", cmdRespond)
+    efun("mount-bundle", cmdMountBundle)
+    efun("unmount-bundle", cmdUnmountBundle)
     else {
         WebWireHandler *h = this;
         r_err(asprintf("Unknown command '%s'", cmd.c_str()));
@@ -985,6 +1544,12 @@ void WebWireHandler::event(Event_t msg)
         processInput(line);
     } else if (msg.is_a(id_readline_eof) || msg.is_a(id_readline_error)) {
         this->inputStopped(msg);
+    } else if (msg.is_a(id_window_geometry)) {
+        int win, x, y, w, h;
+        bool moved, resized;
+        msg >> win >> moved >> x >> y >> resized >> w >> h;
+        if (moved) { windowMoved(win, x, y); }
+        if (resized) { windowResized(win, w, h); }
     } else if (msg.is_a(id_handler_log)) {
         FILE *std_f;
         const char *kind;
@@ -1041,18 +1606,22 @@ std::stringlist WebWireHandler::splitArgs(std::string l, void (log_f(const char
     bool prev_escape = false;
     for(i = 0, N = l.size(); i < N; ) {
         if (is_space(l[i]) && !in_str) {
-            char buf[10200];
-            sprintf(buf, "l = %s, from = %d, i - from = %d, i = %d", l.c_str(), from, i - from, i);
-            if (log_f != nullptr) log_f(buf);
+            if (log_f != nullptr) {
+                char buf[10200];
+                snprintf(buf, sizeof(buf), "l = %s, from = %d, i - from = %d, i = %d", l.c_str(), from, i - from, i);
+                log_f(buf);
+            }
             append(l.substr(from, i - from));
             while (i < N && is_space(l[i])) { i++; }
             from = i;
         } else if (l[i] == '\"') {
             if (in_str) {
                 if (!prev_escape) {
-                    char buf[10240];
-                    sprintf(buf, "l = %s, from = %d, i - from = %d, i = %d", l.c_str(), from, i - from, i);
-                    if (log_f != nullptr) log_f(buf);
+                    if (log_f != nullptr) {
+                        char buf[10240];
+                        snprintf(buf, sizeof(buf), "l = %s, from = %d, i - from = %d, i = %d", l.c_str(), from, i - from, i);
+                        log_f(buf);
+                    }
                     std::string s = replace(l.substr(from, i - from), "\\\"", "\"");
                     append(s);
                     i += 1;
@@ -1077,9 +1646,11 @@ std::stringlist WebWireHandler::splitArgs(std::string l, void (log_f(const char
         }
     }
     if (from != N) {
-        char buf[10240];
-        sprintf(buf, "l = %s, N = %d, i = %d", l.c_str(), N, i);
-        if (log_f != nullptr) log_f(buf);
+        if (log_f != nullptr) {
+            char buf[10240];
+            snprintf(buf, sizeof(buf), "l = %s, N = %d, i = %d", l.c_str(), N, i);
+            log_f(buf);
+        }
         append(l.substr(from));
     }
 
@@ -1353,6 +1924,9 @@ void WebWireHandler::closeListener()
 
 void WebWireHandler::doQuit()
 {
+    _pool_sizes.clear();        // No refills while the pooled windows are closed
+    _pool_timer->stop();
+
     wwlist<int> wins = _windows.keys();
     wwlist<int>::iterator it;
     for(it = wins.begin(); it != wins.end(); it++) {
@@ -1405,7 +1979,15 @@ WebWireHandler::WebWireHandler(Application_t *app, int argc, char *argv[],
     _app = app;
 
     _window_nr = 0;
+    _hidden_nr = 0;
     _code_handle = 0;
+
+    _pool_timer = new Timer_t("window-pool-timer");
+    _pool_timer->setSingleShot(true);
+    connect(_pool_timer, id_timeout, this);
+    _pool_refill_scheduled = false;
+    _pool_hits = 0;
+    _pool_misses = 0;
     _min_log_level = WebWireLogLevel_t::debug;
 
     std::error_code ec;
@@ -1460,6 +2042,9 @@ WebWireHandler::~WebWireHandler()
         (*it)->deleteInProgress("WebWireHandler");
     }
 
+    _pool_timer->stop();
+    delete _pool_timer;
+
     std::error_code ec;
     std::filesystem::path tmp_dir = std::filesystem::temp_directory_path(ec);
     std::filesystem::path wr_dir = tmp_dir.append("web-ui-wire");
@@ -1506,6 +2091,21 @@ void WebWireHandler::windowCloses(int win, bool do_close)
         _timers.erase(win);
         _infos.erase(win);
 
+        bool known = hostKnows(win);
+        bool pooled = _pooled.contains(win);
+        if (pooled) {
+            _pool[_pooled[win]].remove(win);
+            _pooled.erase(win);
+        }
+        if (_companions.contains(win)) {
+            _prerenders.erase(_companions[win]);
+            _companions.erase(win);
+        }
+        int companion = -1;
+        if (_prerenders.contains(win)) {
+            companion = _prerenders[win];
+        }
+
         if (do_close) {
             //w->dontCallback();
             w->setClosing(true);
@@ -1523,7 +2123,15 @@ void WebWireHandler::windowCloses(int win, bool do_close)
         }
         delete i;   // delete i after w, because otherwise the WebEnginProfile gets deleted before the WebEnginePage.
 
-        evt(asprintf("closed:%d", win));
+        if (pooled) {
+            scheduleRefill();
+        }
+        if (known) {
+            evt(asprintf("closed:%d", win));
+        }
+        if (companion > 0) {
+            closeWindow(companion);     // Its prerendered page has no use anymore
+        }
 
         // If no windows left, call webui_clean.
         if (_windows.empty()) {
@@ -1541,8 +2149,10 @@ void WebWireHandler::requestClose(int win)
 
 void WebWireHandler::windowResized(int win, int w, int h)
 {
-    // We get these resizes from javascript and they are
-    // "cleaned", i.e. will trigger not often
+    // We get these resizes from the native window or from javascript
+    // and they are coalesced, i.e. will trigger not often
+    if (!_infos.contains(win)) { return; }  // window has been closed in the mean time
+    if (!hostKnows(win)) { return; }
     WinInfo_t *i = _infos[win];
     i->size = Size_t(w,h);
     JSON j;
@@ -1553,6 +2163,7 @@ void WebWireHandler::windowResized(int win, int w, int h)
 
 void WebWireHandler::windowMoved(int win, int x, int y)
 {
+    if (!_infos.contains(win) || !hostKnows(win)) { return; }
     WinInfo_t *i = _infos[win];
     i->pos = Point_t(x, y);
     JSON j;
@@ -1567,6 +2178,11 @@ void WebWireHandler::handleTimer(Event_t e)
     e >> timer_name;
 
     Timer_t *t = static_cast<Timer_t *>(e.sender());
+    if (t == _pool_timer) {
+        _pool_refill_scheduled = false;
+        refillPool();
+        return;
+    }
     int win = t->property("win").toInt();
 
     message(asprintf("Window %d: Timer %s fired (timeout ms = %d), check if (still) disconnected",
@@ -1585,23 +2201,249 @@ void WebWireHandler::handleTimer(Event_t e)
 
 }
 
-int WebWireHandler::newWindow(const std::string &profile, bool in_browser, int parent_win_id)
+std::string WebWireHandler::internalProfile(const std::string &profile)
+{
+    static std::regex re_ws("\\s+");
+    return std::regex_replace(trim_copy(profile), re_ws, "_");
+}
+
+int WebWireHandler::newWindow(const std::string &profile, bool in_browser, int parent_win_id, const WindowSpec_t *spec)
+{
+    // Pooled windows are plain, non modal webview windows that already show a page
+    bool poolable = !in_browser && parent_win_id <= 0 && (spec == nullptr || (!spec->hasContent() && spec->css == ""));
+    if (poolable) {
+        std::string pool_profile = internalProfile(profile);
+        if (_pool_sizes.contains(pool_profile)) {
+            scheduleRefill();
+            if (!_pool[pool_profile].empty()) {
+                int pooled_win = _pool[pool_profile].front();
+                _pool[pool_profile].pop_front();
+                _pooled.erase(pooled_win);
+                _pool_hits += 1;
+                int win = ++_window_nr;        // Now the host gets to know it, under the next id
+                renumberWindow(pooled_win, win);
+                WebUIWindow *w = _windows[win];
+                w->attach();
+                if (spec != nullptr) {
+                    if (spec->size_set) { resizeWindow(win, spec->width, spec->height); }
+                    if (spec->pos_set) { moveWindow(win, spec->x, spec->y); }
+                    if (spec->icon != "") { setWindowIcon(win, spec->icon); }
+                    if (spec->title != "") { setWindowTitle(win, spec->title); }
+                }
+                w->setShowState(shown);
+                return win;
+            }
+            _pool_misses += 1;
+        }
+    }
+
+    return createWindow(profile, in_browser, parent_win_id, false, spec);
+}
+
+void WebWireHandler::setWindowPool(const std::string &profile, int size)
+{
+    std::string pool_profile = internalProfile(profile);
+    if (size > 0) {
+        _pool_sizes[pool_profile] = size;
+    } else {
+        _pool_sizes.erase(pool_profile);
+    }
+
+    int keep = (size > 0) ? size : 0;
+    wwlist<int> &warm = _pool[pool_profile];
+    while (static_cast<int>(warm.size()) > keep) {
+        int win = warm.back();
+        if (!closeWindow(win)) {       // Else windowCloses() takes it out of the pool
+            warm.pop_back();
+            _pooled.erase(win);
+        }
+    }
+
+    scheduleRefill();
+}
+
+JSON WebWireHandler::windowPoolStats()
+{
+    JSON sizes;
+    JSON warm;
+    for(auto &[profile, size] : _pool_sizes) {
+        sizes[profile] = size;
+        warm[profile] = static_cast<int>(_pool[profile].size());
+    }
+
+    JSON j;
+    j["hits"] = _pool_hits;
+    j["misses"] = _pool_misses;
+    j["sizes"] = sizes;
+    j["warm"] = warm;
+    return j;
+}
+
+void WebWireHandler::scheduleRefill()
+{
+    if (!_pool_refill_scheduled) {
+        _pool_refill_scheduled = true;
+        _pool_timer->stop();
+        _pool_timer->start(WINDOW_POOL_REFILL_MS);
+    }
+}
+
+void WebWireHandler::refillPool()
+{
+    for(auto &[profile, size] : _pool_sizes) {
+        wwlist<int> &warm = _pool[profile];
+        if (static_cast<int>(warm.size()) < size) {
+            int win = createWindow(profile, false, -1, true);
+            warm.push_back(win);
+            _pooled[win] = profile;
+            scheduleRefill();       // One window per tick, so commands keep flowing
+            return;
+        }
+    }
+}
+
+bool WebWireHandler::swappable(int win, std::string &error)
+{
+    // The companion is a new, plain webview window: a swap would turn a browser window into
+    // a native one, orphan a modal window, or leave the children of a parent without it
+    WebUIWindow *w = getWindow(win);
+    if (w->inBrowser()) {
+        error = "in-browser windows cannot be swapped";
+        return false;
+    }
+    if (w->parentWindow() != nullptr) {
+        error = "modal windows cannot be swapped";
+        return false;
+    }
+    for(auto &[id, other] : _windows) {
+        if (other->parentWindow() == w) {
+            error = asprintf("window %d has window %d as parent", id, win);
+            return false;
+        }
+    }
+    return true;
+}
+
+int WebWireHandler::prerender(int win, const std::string &file, std::string &error)
 {
-    ++_window_nr;
+    WebUIWindow *w = getWindow(win);
+    if (w == nullptr || w->detached() || !swappable(win, error)) {
+        return -1;
+    }
+
+    if (_prerenders.contains(win)) {        // Reuse the companion's webview for the next page
+        WebUIWindow *c = _windows[_prerenders[win]];
+        bool ok;
+        std::string url = c->fileUrl(file, ok);
+        return (ok) ? c->setHtml(url) : -1;
+    }
+
+    WinInfo_t *i = _infos[win];
+    WindowSpec_t spec;
+    spec.html = file;
+    if (i->size_set) { spec.size_set = true; spec.width = i->size.width(); spec.height = i->size.height(); }
+    if (i->pos_set) { spec.pos_set = true; spec.x = i->pos.x(); spec.y = i->pos.y(); }
+
+    int cid = createWindow(i->app_name, false, -1, true, &spec, win);
+    return _windows[cid]->currentHandle();
+}
+
+int WebWireHandler::swapPrerendered(int win, std::string &error)
+{
+    // This is a new-window swap: webui has one webview per native window, so the companion's
+    // OS window is shown and the old one is closed. Focus, the taskbar entry and the window
+    // manager's placement move with it.
+    if (!_prerenders.contains(win) || !_windows.contains(win)) {
+        return -1;
+    }
+    if (!swappable(win, error)) {       // It may have become a parent since the prerender
+        return -1;
+    }
+
+    int cid = _prerenders[win];
+    _prerenders.erase(win);
+    _companions.erase(cid);
+
+    WebUIWindow *o = _windows[win];
+    Timer_t *ot = _timers[win];
+    WinInfo_t *oi = _infos[win];
+    WebUIWindow *c = _windows[cid];
+    Timer_t *ct = _timers[cid];
+    WinInfo_t *ci = _infos[cid];
+    _windows.erase(cid);
+    _timers.erase(cid);
+    _infos.erase(cid);
+
+    // The companion takes the place, and the wire id, of the window
+    ci->size = oi->size;
+    ci->size_set = oi->size_set;
+    ci->pos = oi->pos;
+    ci->pos_set = oi->pos_set;
+    if (ci->size_set) { c->resize(ci->size.width(), ci->size.height()); }
+    if (ci->pos_set) { c->move(ci->pos.x(), ci->pos.y()); }
+    c->setId(win);
+    c->attach();
+    ct->setProperty("win", win);
+    _windows[win] = c;
+    _timers[win] = ct;
+    _infos[win] = ci;
+    c->setShowState(shown);
+
+    ot->stop();
+    o->setClosing(true);
+    o->close();
+    delete ot;
+    delete o;
+    delete oi;      // The profile is still used by the companion
+
+    return c->currentHandle();
+}
+
+bool WebWireHandler::hostKnows(int win)
+{
+    return !_pooled.contains(win) && !_companions.contains(win);
+}
+
+void WebWireHandler::renumberWindow(int from, int to)
+{
+    WebUIWindow *w = _windows[from];
+    Timer_t *t = _timers[from];
+    WinInfo_t *i = _infos[from];
+    _windows.erase(from);
+    _timers.erase(from);
+    _infos.erase(from);
+
+    w->setId(to);
+    t->setProperty("win", to);
+    _windows[to] = w;
+    _timers[to] = t;
+    _infos[to] = i;
+}
+
+int WebWireHandler::createWindow(const std::string &profile, bool in_browser, int parent_win_id, bool hidden,
+                                 const WindowSpec_t *spec, int companion_of)
+{
+    // Windows the host does not know yet (pooled or prerendering) are numbered apart, below 0,
+    // so the ids the host sees stay consecutive. They are renumbered when they are claimed.
+    int win = (hidden) ? --_hidden_nr : ++_window_nr;
+
+    if (companion_of > 0) {
+        _prerenders[companion_of] = win;
+        _companions[win] = companion_of;
+    }
 
     Timer_t *t = new Timer_t("window-close-timer");
-    _timers[_window_nr] = t;
-    t->setProperty("win", _window_nr);
+    _timers[win] = t;
+    t->setProperty("win", win);
     t->setSingleShot(true);
     connect(t, id_timeout, this);
 
     WinInfo_t *i = new WinInfo_t();
-    _infos[_window_nr] = i;
+    _infos[win] = i;
 
     i->app_name = profile;
 
-    static std::regex re_ws("\\s+");
-    std::string app_internal_profile = std::regex_replace(trim_copy(profile), re_ws, "_");
+    std::string app_internal_profile = internalProfile(profile);
     //i->base_url = asprintf("http://127.0.0.1:%d/", _port) + app_internal_profile + "/";
 
     if (_profiles.contains(app_internal_profile)) {
@@ -1614,15 +2456,21 @@ int WebWireHandler::newWindow(const std::string &profile, bool in_browser, int p
         i->profile = p;
     }
 
+    if (spec != nullptr) {
+        if (spec->size_set) { i->size = Size_t(spec->width, spec->height); i->size_set = true; }
+        if (spec->pos_set) { i->pos = Point_t(spec->x, spec->y); i->pos_set = true; }
+    }
+
     WebUIWindow *parent_win = nullptr;
     if (parent_win_id > 0) {
         parent_win = getWindow(parent_win_id);
     }
 
-    WebUIWindow *w = new WebUIWindow(this, _window_nr, profile, in_browser, parent_win, this);
-    _windows[_window_nr] = w;
+    WebUIWindow *w = new WebUIWindow(this, win, profile, in_browser, parent_win, this, hidden, spec, companion_of);
+    _windows[win] = w;
+    connect(w, id_window_geometry, this);
 
-    return _window_nr;
+    return win;
 }
 
 WebUIWindow *WebWireHandler::getWindow(int win)
@@ -1884,6 +2732,38 @@ void WebWireHandler::execJs(int win, const std::string &code, std::string tag)
     e.run(code);
 }
 
+void WebWireHandler::invoke(int win, const std::string &fn, const JSON &args, bool &ok, std::string &result)
+{
+    ExecJs e(this, win, fn, false);
+
+    ok = false;
+    result = e.invoke(fn, args, ok);
+}
+
+void WebWireHandler::invoke(int win, const std::string &fn, const JSON &args)
+{
+    ExecJs e(this, win, fn, true);
+    e.invoke(fn, args);
+}
+
+void WebWireHandler::definePageFunction(int win, const std::string &name, const std::string &function_code)
+{
+    WinInfo_t *i = getWinInfo(win);
+    if (i == nullptr) {
+        return;
+    }
+
+    WebWireProfile *p = i->profile;
+    p->definePageFunction(name, function_code);     // For pages loaded from now on
+
+    std::string js = WebWireProfile::registerCode(name, function_code);
+    for(auto &[w, info] : _infos) {
+        if (info->profile == p && _windows.contains(w)) {
+            execJs(w, js, "define-function");
+        }
+    }
+}
+
 //WebWireView *WebWireHandler::getView(int win)
 //{
     /*TODO
@@ -29,13 +29,24 @@ WebWireProfile::WebWireProfile(const std::string &name, const std::string &defau
     dom_access.setName("dom_access");
     dom_access.setSourceCode(
         asprintf(
+            // patch-html only applies to content that is still as webui-wire left it; the sum of
+            // innerHTML is kept per element after each set or patch
+            "window._web_wire_html_sums = new WeakMap();\n"
+            "window._web_wire_html_sum = function(el) {\n"
+            "  let s = el.innerHTML;\n"
+            "  let h = 2166136261;\n"
+            "  for(let i = 0; i < s.length; i++) { h = Math.imul(h ^ s.charCodeAt(i), 16777619); }\n"
+            "  return s.length + ':' + (h >>> 0);\n"
+            "};\n"
             "window.dom_set_html_%d = function(the_handle, id, data, do_fetch) {\n"
             "  let el = document.getElementById(id);\n"
             "  if (el !== undefined && el !== null) {\n"
             "     if (do_fetch) { \n"
+            "        window._web_wire_html_sums.delete(el);\n"
             "        fetch(data).then(x => x.text()).then(y => el.innerHTML = y);\n"
             "     } else {\n"
             "       el.innerHTML = data;\n"
+            "       window._web_wire_html_sums.set(el, window._web_wire_html_sum(el));\n"
             "     }\n"
             "     let obj = {evt: 'inner-html-set', handle: the_handle, oke: true };"
             "     window._web_wire_put_evt(obj);"
@@ -269,27 +280,30 @@ WebWireProfile::WebWireProfile(const std::string &name, const std::string &defau
         "    return 'json:[]';\n"
         "  }\n"
         "};\n"
-        "window._web_wire_resize_timeout = false;\n"
-        "window.addEventListener('resize', function() {\n"
-        "   clearTimeout(window._web_wire_resize_timeout);\n"
-        "   let f = function() {\n"
-        "     let w = window.outerWidth;\n"
-        "     let h = window.outerHeight;\n"
-        "     web_ui_wire_resize_event(w, h);\n"
-        "   };\n"
-        "   window._web_wire_resize_timeout = setTimeout(f, 250);\n"
-        "});\n"
-        "window._web_wire_x = window.screenX;\n"
-        "window._web_wire_y = window.screenY;\n"
-        "window._web_wire_move_interval = setInterval(function() {\n"
-        "   let x = window.screenX;\n"
-        "   let y = window.screenY;\n"
-        "   if (x != window._web_wire_x || y != window._web_wire_y) {\n"
-        "      window._web_wire_x = x;\n"
-        "      window._web_wire_y = y;\n"
-        "      web_uit_wire_move_event(x, y);\n"
-        "   }\n"
-        "}, 500);\n"
+        // Moves and resizes of webview windows are reported by the native window, a browser has to poll.
+        "if (!window._web_wire_native_geometry) {\n"
+        "  window._web_wire_resize_timeout = false;\n"
+        "  window.addEventListener('resize', function() {\n"
+        "     clearTimeout(window._web_wire_resize_timeout);\n"
+        "     let f = function() {\n"
+        "       let w = window.outerWidth;\n"
+        "       let h = window.outerHeight;\n"
+        "       web_ui_wire_resize_event(w, h);\n"
+        "     };\n"
+        "     window._web_wire_resize_timeout = setTimeout(f, 250);\n"
+        "  });\n"
+        "  window._web_wire_x = window.screenX;\n"
+        "  window._web_wire_y = window.screenY;\n"
+        "  window._web_wire_move_interval = setInterval(function() {\n"
+        "     let x = window.screenX;\n"
+        "     let y = window.screenY;\n"
+        "     if (x != window._web_wire_x || y != window._web_wire_y) {\n"
+        "        window._web_wire_x = x;\n"
+        "        window._web_wire_y = y;\n"
+        "        web_ui_wire_move_event(x, y);\n"
+        "     }\n"
+        "  }, 500);\n"
+        "}\n"
      );
 
     Script_t menus;
@@ -406,6 +420,353 @@ WebWireProfile::WebWireProfile(const std::string &name, const std::string &defau
         "};\n"
      );
 
+    Script_t page_functions;
+    page_functions.setName("page-functions");
+    page_functions.setSourceCode(
+        asprintf(
+            "window._web_wire_fns = {};\n"
+            "window.web_wire_register = function(name, fn) { window._web_wire_fns[name] = fn; };\n"
+            // call = { fn: name, args: [...], result: true if the host waits for a script-result }
+            "window._web_wire_rpc = function(call) {\n"
+            "  try {\n"
+            "    let f = window._web_wire_fns[call.fn];\n"
+            "    if (typeof f !== 'function') { throw new Error('page function ' + call.fn + ' is not registered'); }\n"
+            "    let r = f.apply(null, call.args);\n"
+            "    if (call.result) {\n"
+            "      window._web_wire_put_evt({ evt: 'script-result', result: r + '', result_ok: true, result_msg: '' });\n"
+            "    }\n"
+            "  } catch (e) {\n"
+            "    if (call.result) {\n"
+            "      window._web_wire_put_evt({ evt: 'script-result', result: '', result_ok: false, result_msg: e.message });\n"
+            "    } else {\n"
+            "      console.error(e);\n"
+            "    }\n"
+            "  }\n"
+            "};\n"
+            // webui_send_raw() delivers the call as utf-8 bytes, nothing needs to be compiled
+            "window._web_wire_rpc_decoder = new TextDecoder();\n"
+            "window._web_wire_rpc_raw = function(data) {\n"
+            "  window._web_wire_rpc(JSON.parse(window._web_wire_rpc_decoder.decode(data)));\n"
+            "};\n"
+            "web_wire_register('set-html', window.dom_set_html_%d);\n"
+            "web_wire_register('get-html', window.dom_get_html_%d);\n"
+            "web_wire_register('set-attr', window.dom_set_attr_%d);\n"
+            "web_wire_register('get-attr', window.dom_get_attr_%d);\n"
+            "web_wire_register('get-attrs', window.dom_get_attrs_%d);\n"
+            "web_wire_register('del-attr', window.dom_del_attr_%d);\n"
+            "web_wire_register('add-style', window.dom_add_style_%d);\n"
+            "web_wire_register('set-style', window.dom_set_style_%d);\n"
+            "web_wire_register('get-style', window.dom_get_style_%d);\n"
+            "web_wire_register('set-css', window.dom_set_css_%d);\n"
+            "web_wire_register('get-elements', window.dom_get_elements_%d);\n"
+            "web_wire_register('bind', window._web_wire_bind_evt_ids);\n"
+            "web_wire_register('on', function(event, id) {\n"
+            "  let el = document.getElementById(id);\n"
+            "  if (el === null) { return 'bool:false'; }\n"
+            "  el.addEventListener(event, function(e) {\n"
+            "    let obj = { evt: event, id: id, js_evt: window._web_wire_event_info(event, id, e) };\n"
+            "    window._web_wire_put_evt(obj);\n"
+            "  });\n"
+            "  return 'bool:true';\n"
+            "});\n"
+            "web_wire_register('element-info', function(id) {\n"
+            "  let el = document.getElementById(id);\n"
+            "  let obj;\n"
+            "  if (el === null) {\n"
+            "    obj = [ id, '', '', false ];\n"
+            "  } else {\n"
+            "    let type = el.getAttribute('type');\n"
+            "    if (type === null) { type = ''; }\n"
+            "    obj = [ id, el.nodeName, type, true ];\n"
+            "  }\n"
+            "  return 'json:' + JSON.stringify(obj);\n"
+            "});\n"
+            "web_wire_register('value', function(id, set, val) {\n"
+            "  let el = document.getElementById(id);\n"
+            "  if (set) { el.value = val; }\n"
+            "  return el.value;\n"
+            "});\n"
+            "web_wire_register('add-class', function(id, cl) {\n"
+            "  let el = document.getElementById(id);\n"
+            "  if (el === null) { return 'bool:false'; }\n"
+            "  let c = el.getAttribute('class');\n"
+            "  if (c === null) { c = ''; }\n"
+            "  c = c.replace(cl, '');\n"
+            "  c += ' ' + cl;\n"
+            "  el.setAttribute('class', c.replace(/\\s+/g, ' '));\n"
+            "  return 'bool:true';\n"
+            "});\n"
+            "web_wire_register('remove-class', function(id, cl) {\n"
+            "  let el = document.getElementById(id);\n"
+            "  if (el === null) { return 'bool:false'; }\n"
+            "  let c = el.getAttribute('class');\n"
+            "  if (c === null) { c = ''; }\n"
+            "  c = c.replace(cl, '');\n"
+            "  el.setAttribute('class', c.replace(/\\s+/g, ' '));\n"
+            "  return 'bool:true';\n"
+            "});\n"
+            // A transaction is a list of [op, id, args...], applied in one animation frame.
+            // Hidden pages get no animation frames, there it is applied right away.
+            "window._web_wire_tx_ops = {\n"
+            "  'set-attr': window._web_wire_fns['set-attr'],\n"
+            "  'del-attr': window._web_wire_fns['del-attr'],\n"
+            "  'set-style': window._web_wire_fns['set-style'],\n"
+            "  'add-style': window._web_wire_fns['add-style'],\n"
+            "  'add-class': window._web_wire_fns['add-class'],\n"
+            "  'remove-class': window._web_wire_fns['remove-class'],\n"
+            "  'set-inner-html': function(id, html) { document.getElementById(id).innerHTML = html; }\n"
+            "};\n"
+            "web_wire_register('transaction', function(the_handle, ops) {\n"
+            "  let apply = function() {\n"
+            "    let failed = [];\n"
+            "    ops.forEach(function(op, i) {\n"
+            "      try {\n"
+            "        if (document.getElementById(op[1]) === null) { throw new Error('element with id ' + op[1] + ' not found'); }\n"
+            "        window._web_wire_tx_ops[op[0]].apply(null, op.slice(1));\n"
+            "      } catch (e) {\n"
+            "        console.error(e);\n"
+            "        failed.push(i);\n"
+            "      }\n"
+            "    });\n"
+            "    let obj = { evt: 'transaction-applied', handle: the_handle, applied: ops.length - failed.length, failed: failed };\n"
+            "    window._web_wire_put_evt(obj);\n"
+            "  };\n"
+            "  if (document.hidden) { apply(); } else { window.requestAnimationFrame(apply); }\n"
+            "  return 'bool:true';\n"
+            "});\n"
+            // A query is a list of [id or selector, property]; the answer lists the values in the same order
+            "window._web_wire_query_el = function(target) {\n"
+            "  let el = document.getElementById(target);\n"
+            "  if (el === null) {\n"
+            "    try { el = document.querySelector(target); } catch (e) { el = null; }\n"
+            "  }\n"
+            "  return el;\n"
+            "};\n"
+            "window._web_wire_form_data = function(el) {\n"
+            "  let data = {};\n"
+            "  let controls = (el.elements !== undefined) ? el.elements : el.querySelectorAll('input, select, textarea');\n"
+            "  for(const c of controls) {\n"
+            "    let key = c.name || c.id;\n"
+            "    if (!key || c.disabled || c.type === 'submit' || c.type === 'button' || c.type === 'reset') { continue; }\n"
+            "    if (c.type === 'checkbox') { data[key] = c.checked; }\n"
+            "    else if (c.type === 'radio') { if (c.checked) { data[key] = c.value; } else if (!(key in data)) { data[key] = null; } }\n"
+            "    else if (c.type === 'select-multiple') { data[key] = Array.from(c.selectedOptions).map(o => o.value); }\n"
+            "    else { data[key] = c.value; }\n"
+            "  }\n"
+            "  return data;\n"
+            "};\n"
+            "window._web_wire_query_prop = function(el, prop) {\n"
+            "  if (prop === 'exists') { return el !== null; }\n"
+            "  if (el === null) { return null; }\n"
+            "  if (prop === 'value') { return (el.value === undefined) ? null : el.value; }\n"
+            "  if (prop === 'checked') { return (el.checked === undefined) ? null : el.checked; }\n"
+            "  if (prop === 'html') { return el.innerHTML; }\n"
+            "  if (prop === 'text') { return el.textContent; }\n"
+            "  if (prop === 'form') { return window._web_wire_form_data(el); }\n"
+            "  if (prop === 'attrs') {\n"
+            "    let attrs = {};\n"
+            "    for(const name of el.getAttributeNames()) { attrs[name] = el.getAttribute(name); }\n"
+            "    return attrs;\n"
+            "  }\n"
+            "  if (prop.startsWith('attr:')) { return el.getAttribute(prop.substring(5)); }\n"
+            "  if (prop.startsWith('style:')) { return el.style.getPropertyValue(prop.substring(6)); }\n"
+            "  if (prop.startsWith('computed:')) { return window.getComputedStyle(el).getPropertyValue(prop.substring(9)); }\n"
+            "  throw new Error('unknown query property ' + prop);\n"
+            "};\n"
+            "web_wire_register('query', function(requests) {\n"
+            "  let results = requests.map(r => window._web_wire_query_prop(window._web_wire_query_el(r[0]), r[1]));\n"
+            "  return 'json:' + JSON.stringify(results);\n"
+            "});\n"
+            // Applies a patch computed by HtmlDiff_t. All nodes are resolved and checked against the tree
+            // webui-wire expects before anything changes; on a mismatch the host is asked to resend the html.
+            "window._web_wire_decode = function(s) {\n"
+            "  if (s.indexOf('&') < 0) { return s; }\n"
+            "  let t = document.createElement('textarea');\n"
+            "  t.innerHTML = s;\n"
+            "  return t.value;\n"
+            "};\n"
+            "window._web_wire_fragment = function(parent, html) {\n"
+            "  let t = document.createElement('template');\n"
+            "  if (parent.namespaceURI === 'http://www.w3.org/2000/svg' && parent.nodeName !== 'foreignObject') {\n"
+            "    t.innerHTML = '<svg>' + html + '</svg>';\n"
+            "    let f = document.createDocumentFragment();\n"
+            "    let svg = t.content.firstChild;\n"
+            "    while (svg.firstChild) { f.appendChild(svg.firstChild); }\n"
+            "    return f;\n"
+            "  }\n"
+            "  t.innerHTML = html;\n"
+            "  return t.content;\n"
+            "};\n"
+            // Adds html next to or inside an element; with max > 0 the receiving element keeps at most max
+            // element children, dropping the ones farthest from where the html went
+            "web_wire_register('insert-html', function(id, position, html, max) {\n"
+            "  let el = document.getElementById(id);\n"
+            "  if (el === null) { throw new Error('element with id ' + id + ' not found'); }\n"
+            "  el.insertAdjacentHTML(position, html);\n"
+            "  if (max > 0 && (position === 'afterbegin' || position === 'beforeend')) {\n"
+            "    let from_end = (position === 'afterbegin');\n"
+            "    while (el.childElementCount > max) {\n"
+            "      let c = from_end ? el.lastElementChild : el.firstElementChild;\n"
+            "      while ((from_end ? el.lastChild : el.firstChild) !== c) { (from_end ? el.lastChild : el.firstChild).remove(); }\n"
+            "      c.remove();\n"
+            "    }\n"
+            "  }\n"
+            "  return 'bool:true';\n"
+            "});\n"
+            // A virtual list renders only the rows in view plus 'overscan' and asks for missing rows with
+            // rows-needed events; rows arrive through set-rows and are kept up to 'keep' rows
+            "window._web_wire_vlists = {};\n"
+            "window._web_wire_vl_esc = function(s) {\n"
+            "  return String(s).replace(/&/g, '&amp;').replace(/</g, '&lt;').replace(/>/g, '&gt;').replace(/\"/g, '&quot;');\n"
+            "};\n"
+            "window._web_wire_vl_cells = function(vl, row) {\n"
+            "  let cells = Array.isArray(row) ? row : [ row ];\n"
+            "  return cells.map(c => '<div class=\"web-wire-vl-cell\">' + (vl.html ? c : window._web_wire_vl_esc(c)) + '</div>').join('');\n"
+            "};\n"
+            "window._web_wire_vl_render = function(vl) {\n"
+            "  vl.scheduled = false;\n"
+            "  let top = Math.max(0, vl.el.scrollTop - vl.header_height);\n"
+            "  let n = Math.ceil(vl.el.clientHeight / vl.row_height) + 1;\n"
+            "  let first = Math.max(0, Math.floor(top / vl.row_height) - vl.overscan);\n"
+            "  let last = Math.min(vl.rows, Math.floor(top / vl.row_height) + n + vl.overscan);\n"
+            "  let now = Date.now();\n"
+            "  let miss_from = -1, miss_to = -1;\n"
+            "  for(let i = first; i < last; i++) {\n"
+            "    let p = vl.pending.get(i);\n"
+            "    if (!vl.cache.has(i) && (p === undefined || now - p > 5000)) {\n"
+            "      if (miss_from < 0) { miss_from = i; }\n"
+            "      miss_to = i;\n"
+            "    }\n"
+            "  }\n"
+            "  if (miss_from >= 0) {\n"
+            "    for(let i = miss_from; i <= miss_to; i++) { vl.pending.set(i, now); }\n"
+            "    window._web_wire_put_evt({ evt: 'rows-needed', id: vl.id, from: miss_from, count: miss_to - miss_from + 1 });\n"
+            "  }\n"
+            "  if (first === vl.first && last === vl.last && !vl.dirty) { return; }\n"
+            "  let html = '';\n"
+            "  for(let i = first; i < last; i++) {\n"
+            "    let row = vl.cache.get(i);\n"
+            "    let cl = (row === undefined) ? 'web-wire-vl-row web-wire-vl-loading' : 'web-wire-vl-row';\n"
+            "    html += '<div class=\"' + cl + '\" data-row=\"' + i + '\" style=\"display:flex;height:' + vl.row_height + 'px;overflow:hidden\">' +\n"
+            "            ((row === undefined) ? '' : window._web_wire_vl_cells(vl, row)) + '</div>';\n"
+            "  }\n"
+            "  vl.layer.style.transform = 'translateY(' + (first * vl.row_height) + 'px)';\n"
+            "  vl.layer.innerHTML = html;\n"
+            "  vl.first = first;\n"
+            "  vl.last = last;\n"
+            "  vl.dirty = false;\n"
+            "};\n"
+            "window._web_wire_vl_schedule = function(vl) {\n"
+            "  if (!vl.scheduled) {\n"
+            "    vl.scheduled = true;\n"
+            "    window.requestAnimationFrame(function() { window._web_wire_vl_render(vl); });\n"
+            "  }\n"
+            "};\n"
+            "web_wire_register('virtual-list', function(id, spec) {\n"
+            "  let el = document.getElementById(id);\n"
+            "  if (el === null) { throw new Error('element with id ' + id + ' not found'); }\n"
+            "  let vl = { id: id, el: el, rows: spec.rows, row_height: spec.row_height, overscan: spec.overscan,\n"
+            "             html: spec.html, keep: spec.keep, cache: new Map(), pending: new Map(),\n"
+            "             first: -1, last: -1, dirty: true, scheduled: false, header_height: 0 };\n"
+            "  el.innerHTML = '';\n"
+            "  el.style.overflowY = 'auto';\n"
+            "  el.style.position = 'relative';\n"
+            "  if (spec.columns.length > 0) {\n"
+            "    let header = document.createElement('div');\n"
+            "    header.className = 'web-wire-vl-header';\n"
+            "    header.style.cssText = 'position:sticky;top:0;z-index:1;display:flex;height:' + vl.row_height + 'px';\n"
+            "    header.innerHTML = window._web_wire_vl_cells({ html: false }, spec.columns);\n"
+            "    el.appendChild(header);\n"
+            "    vl.header_height = vl.row_height;\n"
+            "  }\n"
+            "  vl.spacer = document.createElement('div');\n"
+            "  vl.spacer.style.cssText = 'position:relative;height:' + (vl.rows * vl.row_height) + 'px';\n"
+            "  vl.layer = document.createElement('div');\n"
+            "  vl.layer.className = 'web-wire-vl-rows';\n"
+            "  vl.layer.style.cssText = 'position:absolute;top:0;left:0;right:0;will-change:transform';\n"
+            "  vl.spacer.appendChild(vl.layer);\n"
+            "  el.appendChild(vl.spacer);\n"
+            "  vl.layer.addEventListener('click', function(e) {\n"
+            "    let r = e.target.closest('[data-row]');\n"
+            "    if (r !== null) { window._web_wire_put_evt({ evt: 'row-clicked', id: id, row: parseInt(r.dataset.row) }); }\n"
+            "  });\n"
+            "  el.addEventListener('scroll', function() { window._web_wire_vl_schedule(vl); }, { passive: true });\n"
+            "  if (typeof ResizeObserver === 'function') {\n"
+            "    new ResizeObserver(function() { vl.dirty = true; window._web_wire_vl_schedule(vl); }).observe(el);\n"
+            "  }\n"
+            "  window._web_wire_vlists[id] = vl;\n"
+            "  window._web_wire_vl_schedule(vl);\n"
+            "  return 'bool:true';\n"
+            "});\n"
+            "web_wire_register('set-rows', function(id, from, rows) {\n"
+            "  let vl = window._web_wire_vlists[id];\n"
+            "  if (vl === undefined) { throw new Error('no virtual list ' + id); }\n"
+            "  rows.forEach(function(row, k) {\n"
+            "    if (from + k < vl.rows) { vl.cache.set(from + k, row); vl.pending.delete(from + k); }\n"
+            "  });\n"
+            "  if (vl.cache.size > vl.keep) {\n"
+            "    let center = (vl.first + vl.last) / 2;\n"
+            "    let far = Array.from(vl.cache.keys()).sort((a, b) => Math.abs(b - center) - Math.abs(a - center));\n"
+            "    far.slice(0, vl.cache.size - vl.keep).forEach(i => vl.cache.delete(i));\n"
+            "  }\n"
+            "  if (from < vl.last && from + rows.length > vl.first) { vl.dirty = true; window._web_wire_vl_schedule(vl); }\n"
+            "  return 'bool:true';\n"
+            "});\n"
+            "web_wire_register('set-row-count', function(id, rows, reset) {\n"
+            "  let vl = window._web_wire_vlists[id];\n"
+            "  if (vl === undefined) { throw new Error('no virtual list ' + id); }\n"
+            "  vl.rows = rows;\n"
+            "  vl.spacer.style.height = (rows * vl.row_height) + 'px';\n"
+            "  if (reset) { vl.cache.clear(); vl.pending.clear(); }\n"
+            "  for(const i of Array.from(vl.cache.keys())) { if (i >= rows) { vl.cache.delete(i); } }\n"
+            "  vl.dirty = true;\n"
+            "  window._web_wire_vl_schedule(vl);\n"
+            "  return 'bool:true';\n"
+            "});\n"
+            "web_wire_register('patch-html', function(the_handle, id, ops) {\n"
+            "  let el = document.getElementById(id);\n"
+            "  let sig = function(n) { return (n.nodeType === 1) ? n.nodeName.toLowerCase() : n.nodeName; };\n"
+            "  let nodes = [];\n"
+            "  let ok = (el !== null) && window._web_wire_html_sums.get(el) === window._web_wire_html_sum(el);\n"
+            "  for(const op of ops) {\n"
+            "    if (!ok) { break; }\n"
+            "    let n = el;\n"
+            "    for(const i of op[1]) { n = (n === undefined) ? undefined : n.childNodes[i]; }\n"
+            "    if (n === undefined) { ok = false; }\n"
+            "    else if (op[0] === 'count') { ok = (n.childNodes.length === op[2]); }\n"
+            "    else if (op[0] !== 'insert') { ok = (sig(n) === op[2]); }\n"
+            "    nodes.push(n);\n"
+            "  }\n"
+            "  if (!ok) {\n"
+            "    window._web_wire_put_evt({ evt: 'inner-html-set', handle: the_handle, oke: false, resync: id });\n"
+            "    return 'bool:false';\n"
+            "  }\n"
+            "  ops.forEach(function(op, k) {\n"
+            "    let n = nodes[k];\n"
+            "    if (op[0] === 'text') { n.data = (n.nodeType === 3) ? window._web_wire_decode(op[3]) : op[3]; }\n"
+            "    else if (op[0] === 'attrs') {\n"
+            "      for(const [a, v] of Object.entries(op[3])) { n.setAttribute(a, window._web_wire_decode(v)); }\n"
+            "      for(const a of op[4]) { n.removeAttribute(a); }\n"
+            "    }\n"
+            "    else if (op[0] === 'replace') { n.replaceWith(window._web_wire_fragment(n.parentNode, op[3])); }\n"
+            "    else if (op[0] === 'remove') { n.remove(); }\n"
+            "    else if (op[0] === 'insert') {\n"
+            "      let before = n.childNodes[op[2]];\n"
+            "      n.insertBefore(window._web_wire_fragment(n, op[3]), (before === undefined) ? null : before);\n"
+            "    }\n"
+            "  });\n"
+            "  window._web_wire_html_sums.set(el, window._web_wire_html_sum(el));\n"
+            "  window._web_wire_put_evt({ evt: 'inner-html-set', handle: the_handle, oke: true, patched: ops.length });\n"
+            "  return 'bool:true';\n"
+            "});\n",
+            world_id, world_id, world_id, world_id, world_id, world_id,
+            world_id, world_id, world_id, world_id, world_id
+            )
+        );
+
+    _host_functions.setName("host-functions");
+    _host_functions.setSourceCode("");
+
     Script_t onload;
     onload.setName("onload-event");
     onload.setSourceCode("window.addEventListener('load', function () {"
@@ -422,20 +783,10 @@ WebWireProfile::WebWireProfile(const std::string &name, const std::string &defau
     _scripts.push_back(eventing);
     _scripts.push_back(_css_script);
     _scripts.push_back(menus);
+    _scripts.push_back(page_functions);
+    _scripts.push_back(_host_functions);
     _scripts.push_back(onload);
 
-    _set_html_name = asprintf("window.dom_set_html_%d", world_id);
-    _get_html_name = asprintf("window.dom_get_html_%d", world_id);
-    _set_attr_name = asprintf("window.dom_set_attr_%d", world_id);
-    _get_attr_name = asprintf("window.dom_get_attr_%d", world_id);
-    _get_attrs_name = asprintf("window.dom_get_attrs_%d", world_id);
-    _del_attr_name = asprintf("window.dom_del_attr_%d", world_id);
-    _add_style_name = asprintf("window.dom_add_style_%d", world_id);
-    _set_style_name = asprintf("window.dom_set_style_%d", world_id);
-    _get_style_name = asprintf("window.dom_get_style_%d", world_id);
-    _get_elements_name = asprintf("window.dom_get_elements_%d", world_id);
-    _set_css_name = asprintf("window.dom_set_css_%d", world_id);
-
     //_world_id = dom_access.worldId();
 
     //fprintf(stderr, "world-id of domaccess: %d\n", dom_access.worldId());
@@ -476,153 +827,201 @@ std::string WebWireProfile::profileName()
     return _profile_name;
 }
 
-void WebWireProfile::exec(WebWireHandler *h, int win, const std::string &name, const std::string &js)
+void WebWireProfile::invoke(WebWireHandler *h, int win, const std::string &fn, const JSON &args)
 {
-    h->message(js);
-    ExecJs e = ExecJs(h, win, name, true);
-    e.run(js);
+    ExecJs e = ExecJs(h, win, fn, true);
+    e.invoke(fn, args);
 }
 
-void WebWireProfile::exec(WebWireHandler *h, int win, const std::string &name, const std::string &js, bool &ok, std::string &result)
+void WebWireProfile::invoke(WebWireHandler *h, int win, const std::string &fn, const JSON &args, bool &ok, std::string &result)
 {
-    h->message(js);
-    ExecJs e(h, win, name, false);
-    result = e.call(js, ok);
+    ExecJs e(h, win, fn, false);
+    result = e.invoke(fn, args, ok);
 }
 
 
 void WebWireProfile::set_html(WebWireHandler *h, int win, int handle, const std::string &element_id, const std::string &data, bool fetch)
 {
-    std::string do_fetch = fetch ? "true" : "false";
-
-    exec(h, win, "set-inner-html",
-         _set_html_name + "(" + asprintf("%d", handle) + ", " + "'" + esc(element_id) + "', " +
-                                          "'" + esc(data) + "', " +
-                                          do_fetch +
-                                    ");"
-              );
+    invoke(h, win, "set-html", Array(handle, element_id, data, fetch));
 }
 
 std::string WebWireProfile::get_html(WebWireHandler *h, int win, const std::string &element_id, bool &ok)
 {
     std::string result;
-    exec(h, win, "get-inner-html",
-                "return " + _get_html_name + "('" + esc(element_id) + "');",
-                ok, result
-                );
+    invoke(h, win, "get-html", Array(element_id), ok, result);
     return result;
 }
 
 void WebWireProfile::set_attr(WebWireHandler *h, int win, const std::string &element_id, const std::string &attr, const std::string &val)
 {
-    exec(h, win, "set-attr",
-                _set_attr_name + "(" + "'" + esc(element_id) + "', " +
-                                          "'" + esc(attr) + "', " +
-                                          "'" + esc(val) + "'" +
-                                    ");"
-              );
+    invoke(h, win, "set-attr", Array(element_id, attr, val));
 }
 
 std::string WebWireProfile::get_attr(WebWireHandler *h, int win, const std::string &element_id, const std::string &attr, bool &ok)
 {
     std::string result;
-    exec(h, win, "get-attr",
-                "return " + _get_attr_name + "(" +  "'" + esc(element_id) + "', " +
-                                           "'" + esc(attr) + "'" +
-                                    ");",
-                ok, result
-              );
+    invoke(h, win, "get-attr", Array(element_id, attr), ok, result);
     return result;
 }
 
 std::string WebWireProfile::get_attrs(WebWireHandler *h, int win, const std::string &element_id, bool &ok)
 {
     std::string result;
-    exec(h, win, "get-attrs",
-                "return " + _get_attrs_name + "(" +  "'" + esc(element_id) + "'" +
-                    ");",
-                ok, result
-                );
+    invoke(h, win, "get-attrs", Array(element_id), ok, result);
     return result;
 }
 
 std::string WebWireProfile::get_elements(WebWireHandler *h, int win, const std::string &selector, bool &ok)
 {
     std::string result;
-    exec(h, win, "get-elements",
-                "return " + _get_elements_name + "(" +  "'" + esc(selector) + "'" +
-                    ");",
-                ok, result
-                );
+    invoke(h, win, "get-elements", Array(selector), ok, result);
     return result;
 }
 
 
 void WebWireProfile::del_attr(WebWireHandler *h, int win, const std::string &element_id, const std::string &attr)
 {
-    exec(h, win, "del-attr",
-                _del_attr_name + "(" +  "'" + esc(element_id) + "', " +
-                              "'" + esc(attr) + "', " +
-                              ");"
-                     );
+    invoke(h, win, "del-attr", Array(element_id, attr));
 }
 
 void WebWireProfile::add_style(WebWireHandler *h, int win, const std::string &element_id, const std::string &style)
 {
-    exec(h, win, "add-style",
-                _add_style_name + "(" +  "'" + esc(element_id) + "', " +
-                    "'" + esc(style) + "'" +
-                    ");"
-                );
+    invoke(h, win, "add-style", Array(element_id, style));
 }
 
 
 void WebWireProfile::set_style(WebWireHandler *h, int win, const std::string &element_id, const std::string &style)
 {
-    return exec(h, win, "set-style",
-                _set_style_name + "(" +  "'" + esc(element_id) + "', " +
-                                            "'" + esc(style) + "'" +
-                                     ");"
-              );
+    invoke(h, win, "set-style", Array(element_id, style));
 }
 
 std::string WebWireProfile::get_style(WebWireHandler *h, int win, const std::string &element_id, bool &ok)
 {
     std::string result;
-    exec(h, win, "get-style",
-                "return " + _get_style_name + "('" + esc(element_id) + "');",
-                ok, result
-                );
+    invoke(h, win, "get-style", Array(element_id), ok, result);
     return result;
 }
 
+void WebWireProfile::patch_html(WebWireHandler *h, int win, int handle, const std::string &element_id, const JSON &ops)
+{
+    invoke(h, win, "patch-html", Array(handle, element_id, ops));
+}
+
+void WebWireProfile::insert_html(WebWireHandler *h, int win, const std::string &element_id, const std::string &position,
+                                 const std::string &html, int max_children)
+{
+    invoke(h, win, "insert-html", Array(element_id, position, html, max_children));
+}
+
+void WebWireProfile::virtual_list(WebWireHandler *h, int win, const std::string &element_id, const JSON &spec)
+{
+    invoke(h, win, "virtual-list", Array(element_id, spec));
+}
+
+void WebWireProfile::set_rows(WebWireHandler *h, int win, const std::string &element_id, int from, const JSON &rows)
+{
+    invoke(h, win, "set-rows", Array(element_id, from, rows));
+}
+
+void WebWireProfile::set_row_count(WebWireHandler *h, int win, const std::string &element_id, int rows, bool reset)
+{
+    invoke(h, win, "set-row-count", Array(element_id, rows, reset));
+}
+
+void WebWireProfile::transaction(WebWireHandler *h, int win, int handle, const JSON &ops)
+{
+    invoke(h, win, "transaction", Array(handle, ops));
+}
+
+std::string WebWireProfile::query(WebWireHandler *h, int win, const JSON &requests, bool &ok)
+{
+    std::string result;
+    invoke(h, win, "query", Array(requests), ok, result);
+    return result;
+}
+
+int WebWireProfile::transactionOpArgs(const std::string &op)
+{
+    if (op == "set-attr") { return 3; }
+    if (op == "del-attr" || op == "set-style" || op == "add-style" ||
+        op == "add-class" || op == "remove-class" || op == "set-inner-html") { return 2; }
+    return -1;
+}
+
 void WebWireProfile::set_css(WebWireHandler *h, int win, const std::string &css)
 {
+    setCss(css);
+    invoke(h, win, "set-css", Array(css));
+}
+
+std::string WebWireProfile::registerCode(const std::string &name, const std::string &function_code)
+{
+    return "web_wire_register('" + esc(name) + "', (" + function_code + "\n));\n";
+}
+
+void WebWireProfile::definePageFunction(const std::string &name, const std::string &function_code)
+{
+    _asset_mutex.lock();
+    _host_function_code[name] = function_code;
+    std::string js;
+    for(auto &[n, code] : _host_function_code) {
+        js += registerCode(n, code);
+    }
+    _host_functions.setSourceCode(js);
+    std::list<Script_t>::iterator it = _scripts.begin();
+    for(; it != _scripts.end(); it++) {
+        if (it->name() == _host_functions.name()) { *it = _host_functions; }
+    }
+    _scripts_asset = "";    // Rebuilt on next use, with a new version in its url
+    _asset_mutex.unlock();
+}
+
+void WebWireProfile::setCss(const std::string &css)
+{
+    _asset_mutex.lock();
     _css  = css;
     _css_script.setSourceCode(cssCode(esc(css)));
-
-    exec(h, win, "set-css",
-                _set_css_name + "('" + esc(css) + "');"
-                );
+    std::list<Script_t>::iterator it = _scripts.begin();
+    for(; it != _scripts.end(); it++) {
+        if (it->name() == _css_script.name()) { *it = _css_script; }
+    }
+    _scripts_asset = "";    // Rebuilt on next use, with a new version in its url
+    _asset_mutex.unlock();
 }
 
-std::string WebWireProfile::scriptsTag()
+void WebWireProfile::buildScriptsAsset()
 {
     std::list<Script_t>::iterator it = _scripts.begin();
-    std::string tag = "";
+    std::string js = "";
     while (it != _scripts.end()) {
-        tag += "<script>";
         Script_t &s = *it;
-        tag += "\n// " + s.name() + "\n" + s.code() + "\n";
-        tag += "</script>";
+        js += "\n// " + s.name() + "\n" + s.code() + "\n";
         it++;
     }
-    return tag;
+    _scripts_asset = js;
+    _scripts_url = std::string(WEB_WIRE_ASSET_PREFIX) + "profile-" + asprintf("%016llx", fnv1a64(js)) + ".js";
 }
 
+std::string WebWireProfile::scriptsAsset(std::string &url)
+{
+    _asset_mutex.lock();
+    if (_scripts_asset == "") {
+        buildScriptsAsset();
+    }
+    std::string js = _scripts_asset;
+    url = _scripts_url;
+    _asset_mutex.unlock();
+    return js;
+}
 
+std::string WebWireProfile::scriptsUrl()
+{
+    std::string url;
+    scriptsAsset(url);
+    return url;
+}
 
-
-
-
-
+std::string WebWireProfile::scriptsTag()
+{
+    return "<script src=\"" + scriptsUrl() + "\"></script>\n";
+}
@@ -0,0 +1,174 @@
+////////////////////////////////////////////////////////////////////////////////////
+// webui-wire-mimegen - generates the static mimetype table used by MimeTypes_t
+// from support/mimetypes.csv. Run by the build, the output is not checked in.
+//
+// usage: webui-wire-mimegen <mimetypes.csv> <mimetypes_table.h>
+//
+// The table is a perfect hash (hash and displace): an extension picks a bucket
+// with seed 0, the seed stored for that bucket picks its slot. Every slot holds
+// at most one extension, so a lookup is two hashes and one compare.
+////////////////////////////////////////////////////////////////////////////////////
+
+#include "mimehash.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <algorithm>
+#include <unordered_set>
+
+typedef struct {
+    std::string ext;
+    std::string mimetype;
+} MimeGenEntry_t;
+
+static std::string trimmed(const std::string &s)
+{
+    size_t b = s.find_first_not_of(" \t\r\n");
+    size_t e = s.find_last_not_of(" \t\r\n");
+    return (b == std::string::npos) ? "" : s.substr(b, e - b + 1);
+}
+
+static std::string cString(const std::string &s)
+{
+    std::string r = "\"";
+    for(char c : s) {
+        if (c == '"' || c == '\\') { r += '\\'; }
+        r += c;
+    }
+    return r + "\"";
+}
+
+// <name>;<mimetype>;<ext>[,<ext>...];<info>, the first mimetype for an extension wins
+static bool readCsv(const char *csv, std::vector<MimeGenEntry_t> &entries)
+{
+    std::ifstream f(csv);
+    if (!f) {
+        return false;
+    }
+    std::unordered_set<std::string> seen;
+    std::string line;
+    while (std::getline(f, line)) {
+        size_t s1 = line.find(";");
+        size_t s2 = (s1 == std::string::npos) ? s1 : line.find(";", s1 + 1);
+        size_t s3 = (s2 == std::string::npos) ? s2 : line.find(";", s2 + 1);
+        if (s3 == std::string::npos) {
+            continue;
+        }
+        std::string mimetype = trimmed(line.substr(s1 + 1, s2 - s1 - 1));
+        std::string exts = line.substr(s2 + 1, s3 - s2 - 1) + ",";
+        size_t from = 0;
+        size_t comma = exts.find(",");
+        while (comma != std::string::npos) {
+            std::string ext = trimmed(exts.substr(from, comma - from));
+            bool is_ext = ext.rfind(".", 0) == 0;      // Skips e.g. 'N/A'
+            ext = std::string(mime_ext(ext));
+            for(char &c : ext) { c = mime_lower(c); }
+            if (is_ext && ext != "" && !seen.contains(ext)) {
+                seen.insert(ext);
+                entries.push_back({ ext, mimetype });
+            }
+            from = comma + 1;
+            comma = exts.find(",", from);
+        }
+    }
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc != 3) {
+        fprintf(stderr, "usage: webui-wire-mimegen <mimetypes.csv> <mimetypes_table.h>\n");
+        return 1;
+    }
+
+    std::vector<MimeGenEntry_t> entries;
+    if (!readCsv(argv[1], entries)) {
+        fprintf(stderr, "Cannot read %s\n", argv[1]);
+        return 1;
+    }
+
+    size_t size = 1;
+    while (size < entries.size() + entries.size() / 4) { size <<= 1; }
+    size_t buckets = (size / 4 > 0) ? size / 4 : 1;
+
+    std::vector<std::vector<size_t>> bucket_keys(buckets);
+    for(size_t i = 0; i < entries.size(); i++) {
+        bucket_keys[mime_hash(entries[i].ext, 0) & (buckets - 1)].push_back(i);
+    }
+
+    // Place the fullest buckets first, they are the hardest to fit
+    std::vector<size_t> order(buckets);
+    for(size_t b = 0; b < buckets; b++) { order[b] = b; }
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return bucket_keys[a].size() > bucket_keys[b].size();
+    });
+
+    std::vector<unsigned int> seeds(buckets, 0);
+    std::vector<long> slots(size, -1);
+    for(size_t b : order) {
+        if (bucket_keys[b].empty()) {
+            continue;
+        }
+        bool placed = false;
+        for(unsigned int seed = 1; !placed && seed < 10000000; seed++) {
+            std::vector<size_t> taken;
+            bool ok = true;
+            for(size_t k : bucket_keys[b]) {
+                size_t slot = mime_hash(entries[k].ext, seed) & (size - 1);
+                if (slots[slot] != -1 || std::find(taken.begin(), taken.end(), slot) != taken.end()) {
+                    ok = false;
+                    break;
+                }
+                taken.push_back(slot);
+            }
+            if (ok) {
+                size_t i = 0;
+                for(size_t k : bucket_keys[b]) {
+                    slots[taken[i++]] = static_cast<long>(k);
+                }
+                seeds[b] = seed;
+                placed = true;
+            }
+        }
+        if (!placed) {
+            fprintf(stderr, "Cannot build a perfect hash for %s\n", argv[1]);
+            return 1;
+        }
+    }
+
+    FILE *out = fopen(argv[2], "w");
+    if (out == nullptr) {
+        fprintf(stderr, "Cannot write %s\n", argv[2]);
+        return 1;
+    }
+
+    fprintf(out, "// Generated by webui-wire-mimegen from support/mimetypes.csv, do not edit\n\n");
+    fprintf(out, "#ifndef MIMETYPES_TABLE_H\n#define MIMETYPES_TABLE_H\n\n#include \"mimehash.h\"\n\n");
+    fprintf(out, "#define MIME_TABLE_ENTRIES %d\n", static_cast<int>(entries.size()));
+    fprintf(out, "#define MIME_TABLE_SIZE    %d\n", static_cast<int>(size));
+    fprintf(out, "#define MIME_TABLE_BUCKETS %d\n\n", static_cast<int>(buckets));
+
+    fprintf(out, "static constexpr unsigned int mime_table_seeds[MIME_TABLE_BUCKETS] = {");
+    for(size_t b = 0; b < buckets; b++) {
+        fprintf(out, "%s%u", (b % 16 == 0) ? "\n    " : " ", seeds[b]);
+        if (b + 1 < buckets) { fprintf(out, ","); }
+    }
+    fprintf(out, "\n};\n\n");
+
+    fprintf(out, "static constexpr MimeTableEntry_t mime_table[MIME_TABLE_SIZE] = {\n");
+    for(size_t s = 0; s < size; s++) {
+        if (slots[s] == -1) {
+            fprintf(out, "    { nullptr, nullptr }");
+        } else {
+            const MimeGenEntry_t &e = entries[slots[s]];
+            fprintf(out, "    { %s, %s }", cString(e.ext).c_str(), cString(e.mimetype).c_str());
+        }
+        fprintf(out, "%s\n", (s + 1 < size) ? "," : "");
+    }
+    fprintf(out, "};\n\n#endif // MIMETYPES_TABLE_H\n");
+    fclose(out);
+
+    return 0;
+}
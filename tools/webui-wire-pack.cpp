@@ -0,0 +1,152 @@
+////////////////////////////////////////////////////////////////////////////////////
+// webui-wire-pack - packs a directory into an asset bundle that webui-wire can
+// serve with 'mount-bundle <url-path-prefix> <bundle-file>'.
+//
+// usage: webui-wire-pack <bundle-file> <directory>
+//
+// The layout of the bundle is described in include/assetbundle_t.h
+////////////////////////////////////////////////////////////////////////////////////
+
+#include "assetbundle_t.h"
+#include "mimetypes_t.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include <algorithm>
+#include <vector>
+
+typedef struct {
+    std::string path;
+    std::string content_type;
+    std::string etag;
+    unsigned int flags;
+    unsigned long long offset;
+    unsigned long long size;
+} PackEntry_t;
+
+static std::string lower(std::string s)
+{
+    for(char &c : s) { c = static_cast<char>(tolower(static_cast<unsigned char>(c))); }
+    return s;
+}
+
+static void putLE(std::string &out, unsigned long long v, int bytes)
+{
+    for(int i = 0; i < bytes; i++) {
+        out += static_cast<char>(v & 0xff);
+        v >>= 8;
+    }
+}
+
+static bool readFile(const std::filesystem::path &p, std::string &content)
+{
+    std::ifstream f(p, std::ios::binary);
+    if (!f) {
+        return false;
+    }
+    std::ostringstream ss;
+    ss << f.rdbuf();
+    content = ss.str();
+    return true;
+}
+
+static void usage()
+{
+    fprintf(stderr, "usage: webui-wire-pack <bundle-file> <directory>\n");
+}
+
+int main(int argc, char *argv[])
+{
+    std::vector<std::string> args;
+
+    for(int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        if (a == "--help" || a == "-h") {
+            usage();
+            return 0;
+        } else {
+            args.push_back(a);
+        }
+    }
+    if (args.size() != 2) {
+        usage();
+        return 1;
+    }
+    std::string bundle_file = args[0];
+    std::filesystem::path dir = args[1];
+
+    std::error_code ec;
+    std::vector<std::filesystem::path> files;
+    for(auto &de : std::filesystem::recursive_directory_iterator(dir, ec)) {
+        if (de.is_regular_file()) {
+            files.push_back(de.path());
+        }
+    }
+    if (ec) {
+        fprintf(stderr, "Cannot read directory %s: %s\n", dir.string().c_str(), ec.message().c_str());
+        return 1;
+    }
+    std::sort(files.begin(), files.end());      // Reproducible bundles
+
+    std::string data;
+    std::vector<PackEntry_t> entries;
+    for(auto &file : files) {
+        std::string content;
+        if (!readFile(file, content)) {
+            fprintf(stderr, "Cannot read %s\n", file.string().c_str());
+            return 1;
+        }
+
+        PackEntry_t e;
+        e.path = std::filesystem::relative(file, dir).generic_string();
+        std::string ext = lower(file.extension().string());
+        std::string_view mimetype = MimeTypes_t::mimetypeByExt(ext);
+        e.content_type = mimetype.empty() ? "application/octet-stream" : std::string(mimetype);
+        char etag[32];
+        snprintf(etag, sizeof(etag), "\"%016llx\"", fnv1a64(content));
+        e.etag = etag;
+        e.flags = (ext == ".html" || ext == ".htm") ? ASSET_BUNDLE_FLAG_HTML : 0;
+
+        data.append((8 - data.size() % 8) % 8, '\0');
+        e.offset = ASSET_BUNDLE_HEADER_SIZE + data.size();
+        e.size = content.size();
+        data += content;
+
+        entries.push_back(e);
+    }
+
+    std::string index;
+    for(auto &e : entries) {
+        putLE(index, e.path.size(), 4);
+        putLE(index, e.content_type.size(), 4);
+        putLE(index, e.etag.size(), 4);
+        putLE(index, e.flags, 4);
+        putLE(index, e.offset, 8);
+        putLE(index, e.size, 8);
+        putLE(index, 0, 8);         // No gzip variant, see assetbundle_t.h
+        putLE(index, 0, 8);
+        index += e.path + e.content_type + e.etag;
+    }
+
+    data.append((8 - data.size() % 8) % 8, '\0');
+    std::string header(ASSET_BUNDLE_MAGIC, ASSET_BUNDLE_MAGIC_SIZE);
+    putLE(header, ASSET_BUNDLE_VERSION, 4);
+    putLE(header, entries.size(), 4);
+    putLE(header, ASSET_BUNDLE_HEADER_SIZE + data.size(), 8);
+    putLE(header, index.size(), 8);
+
+    std::ofstream out(bundle_file, std::ios::binary | std::ios::trunc);
+    out << header << data << index;
+    out.close();
+    if (!out) {
+        fprintf(stderr, "Cannot write %s\n", bundle_file.c_str());
+        return 1;
+    }
+
+    fprintf(stderr, "%s: %d entries, %llu bytes\n", bundle_file.c_str(), static_cast<int>(entries.size()),
+            static_cast<unsigned long long>(header.size() + data.size() + index.size()));
+    return 0;
+}